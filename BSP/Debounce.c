@@ -0,0 +1,129 @@
+/**
+ ******************************************************************************
+ * @file    Debounce.c
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Debounces GPIO inputs, all pins of a port in parallel.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#include "Debounce.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+/****************************************************************
+ * Function declarations
+ ***************************************************************/
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+static const Debounce_ConfigType* Debounce_userCfg = NULL_PTR;
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+void Debounce_Init(const Debounce_ConfigType* config)
+{
+  /* Local variables */
+  uint8_t port;
+  const Debounce_PortConfigType* portConfig;
+
+  /* Initialize local variables */
+  port = 0u;
+  portConfig = NULL_PTR;
+
+  if ((config != NULL_PTR) && (Debounce_userCfg == NULL_PTR))
+  {
+    for (port = 0u; port < config->numberOfPorts; port++)
+    {
+      portConfig = &config->portConfigs[port];
+
+      portConfig->runtime->state = GpioIf_ReadPort(portConfig->port,
+                                                   portConfig->mask);
+      portConfig->runtime->count0 = 0u;
+      portConfig->runtime->count1 = 0u;
+    }
+
+    Debounce_userCfg = config;
+  }
+}
+
+uint16_t Debounce_GetState(const uint8_t port)
+{
+  /* Local variables */
+  uint16_t ret;
+
+  /* Initialize local variables */
+  ret = 0u;
+
+  if ((Debounce_userCfg != NULL_PTR)
+    && (port < Debounce_userCfg->numberOfPorts))
+  {
+    ret = Debounce_userCfg->portConfigs[port].runtime->state;
+  }
+
+  return ret;
+}
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+void Debounce_MsTimer(void)
+{
+  /* Local variables */
+  uint8_t port;
+  const Debounce_PortConfigType* portConfig;
+  Debounce_RuntimeType* runtime;
+  uint16_t delta;
+  uint16_t toggle;
+
+  /* Initialize local variables */
+  port = 0u;
+  portConfig = NULL_PTR;
+
+  if (Debounce_userCfg != NULL_PTR)
+  {
+    for (port = 0u; port < Debounce_userCfg->numberOfPorts; port++)
+    {
+      portConfig = &Debounce_userCfg->portConfigs[port];
+      runtime = portConfig->runtime;
+
+      /* Pins differing from the debounced state count, the others reset */
+      delta = (uint16_t) (GpioIf_ReadPort(portConfig->port, portConfig->mask)
+        ^ runtime->state);
+      runtime->count1 = (uint16_t) ((runtime->count1 ^ runtime->count0) & delta);
+      runtime->count0 = (uint16_t) (~runtime->count0 & delta);
+
+      /* Counter wrapped to 0 while still differing: toggle */
+      toggle = (uint16_t) (delta & ~(runtime->count0 | runtime->count1));
+
+      if (toggle != 0u)
+      {
+        runtime->state ^= toggle;
+
+        if (portConfig->callback != NULL_PTR)
+        {
+          portConfig->callback(toggle, runtime->state);
+        }
+      }
+    }
+  }
+}
+
+/****************************************************************
+ * Static functions
+ ***************************************************************/
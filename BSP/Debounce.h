@@ -0,0 +1,100 @@
+/**
+ ******************************************************************************
+ * @file    Debounce.h
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Debounces GPIO inputs, all pins of a port in parallel.
+ *
+ * Each port is sampled with one read per tick. A 2 bit vertical counter
+ * per pin (two 16 bit words per port) counts consecutive samples which
+ * differ from the debounced state; a pin toggles after 4 such samples.
+ * The cost per tick depends on the number of ports only.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#ifndef DEBOUNCE_H
+#define DEBOUNCE_H
+
+#include "Services/StdDef.h"
+
+#include "GpioIf.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/**
+ * Called if debounced pins of a port changed.
+ * @param changed The pins which changed.
+ * @param state The debounced state of all pins of the port.
+ */
+typedef void (*Debounce_CallbackType)(uint16_t changed, uint16_t state);
+
+/**
+ * Runtime data of one port.
+ */
+typedef struct
+{
+  uint16_t state;
+  /* Vertical counter, bit n of both words is the counter of pin n */
+  uint16_t count0;
+  uint16_t count1;
+} Debounce_RuntimeType;
+
+typedef struct
+{
+  const GpioIf_PortType port;
+  /* The pins to debounce */
+  const uint16_t mask;
+  const Debounce_CallbackType callback;
+  Debounce_RuntimeType* const runtime;
+} Debounce_PortConfigType;
+
+typedef struct
+{
+  const uint8_t numberOfPorts;
+  const Debounce_PortConfigType* portConfigs;
+} Debounce_ConfigType;
+
+/****************************************************************
+ * Macros                                                       *
+ ***************************************************************/
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+extern const Debounce_ConfigType Debounce_config;
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+/**
+ * Initializes the debouncing, the current pin states are taken as
+ *  debounced states. GpioIf has to be initialized before.
+ * @param config Pointer to the configuration.
+ */
+void Debounce_Init(const Debounce_ConfigType* config);
+
+/**
+ * Gets the debounced state of a port.
+ * @param port The debounce port number (index in the configuration).
+ * @return The debounced pin states, pins which are not debounced are 0.
+ */
+uint16_t Debounce_GetState(const uint8_t port);
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+/**
+ * Samples all ports, SysTimerIf callback.
+ */
+void Debounce_MsTimer(void);
+
+#endif
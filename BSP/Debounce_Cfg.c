@@ -0,0 +1,61 @@
+/**
+ ******************************************************************************
+ * @file    Debounce_Cfg.c
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Configuration for Debounce module.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#include "Debounce.h"
+#include "Debounce_Cfg.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+/****************************************************************
+ * Function declarations
+ ***************************************************************/
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+//static Debounce_RuntimeType Debounce_runtimes[DEBOUNCE_NUMBER_OF_PORTS];
+//
+//static const Debounce_PortConfigType Debounce_portConfigs[DEBOUNCE_NUMBER_OF_PORTS] =
+//{
+//  {
+//    DEBOUNCE_PORT0,
+//    DEBOUNCE_MASK0,
+//    DEBOUNCE_CALLBACK0,
+//    &Debounce_runtimes[0]
+//  }
+//};
+
+const Debounce_ConfigType Debounce_config =
+{
+  DEBOUNCE_NUMBER_OF_PORTS,
+  NULL_PTR//Debounce_portConfigs
+};
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+/****************************************************************
+ * Static functions
+ ***************************************************************/
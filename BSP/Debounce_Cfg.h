@@ -0,0 +1,47 @@
+/**
+ ******************************************************************************
+ * @file    Debounce_Cfg.h
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Configuration for Debounce module.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#ifndef DEBOUNCE_CFG_H
+#define DEBOUNCE_CFG_H
+
+#include "Services/StdDef.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/****************************************************************
+ * Macros                                                       *
+ ***************************************************************/
+
+/* Generic settings, the sample period is the SysTimerIf timeout */
+#define DEBOUNCE_NUMBER_OF_PORTS                              0u
+
+/* Port 0 */
+//#define DEBOUNCE_PORT0                                        GpioIf_PortB
+//#define DEBOUNCE_MASK0                                        0x3000u
+//#define DEBOUNCE_CALLBACK0                                    Buttons_Changed
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+#endif
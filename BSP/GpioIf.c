@@ -22,16 +22,69 @@
  * Macros
  ***************************************************************/
 
+/**
+ * De Bruijn constant to get the index of the lowest set bit (the M0 has
+ *  no count leading zeros instruction).
+ */
+#define GPIOIF_DEBRUIJN                 0x077CB531u
+
+/**
+ * Gets the current mode of a pin from the mode register.
+ */
+#define GPIOIF_GET_MODE(registers, pin)                                        \
+  ((GpioIf_ModeType) (((registers)->MODER >> ((pin) * 2u)) & 0x03u))
+
+/**
+ * Gets the index of the only set bit of a mask.
+ */
+#define GPIOIF_BIT_INDEX(bit)                                                  \
+  GpioIf_bitIndices[((uint32_t) (bit) * GPIOIF_DEBRUIJN) >> 27u]
+
 /****************************************************************
  * Function declarations
  ***************************************************************/
 
+/**
+ * Records an edge in the capture queue.
+ * @param line The EXTI line.
+ * @param timestamp The timestamp of the interrupt.
+ */
+static void GpioIf_Capture(uint8_t line, uint32_t timestamp);
+
 /****************************************************************
  * Global variables
  ***************************************************************/
 
 static const GpioIf_ConfigType* GpioIf_userCfg = NULL_PTR;
 
+/**
+ * Callback of each EXTI line, built at initialization. A line is connected
+ *  to one port only, so there is at most one callback per line.
+ */
+static GpioIf_IsrCallbackType GpioIf_lineCallbacks[GPIOIF_NUMBER_OF_PINS_PER_CHANNEL];
+
+/**
+ * Port registers of each EXTI line which records edges, otherwise NULL_PTR.
+ */
+static GpioIf_RegisterType* GpioIf_lineCaptures[GPIOIF_NUMBER_OF_PINS_PER_CHANNEL];
+
+/**
+ * NVIC interrupt of each EXTI line.
+ */
+static const GpioIf_NvicIrqType GpioIf_lineIrqs[GPIOIF_NUMBER_OF_PINS_PER_CHANNEL] =
+{
+  EXTI0_1_IRQn, EXTI0_1_IRQn, EXTI2_3_IRQn, EXTI2_3_IRQn,
+  EXTI4_15_IRQn, EXTI4_15_IRQn, EXTI4_15_IRQn, EXTI4_15_IRQn,
+  EXTI4_15_IRQn, EXTI4_15_IRQn, EXTI4_15_IRQn, EXTI4_15_IRQn,
+  EXTI4_15_IRQn, EXTI4_15_IRQn, EXTI4_15_IRQn, EXTI4_15_IRQn
+};
+
+static const uint8_t GpioIf_bitIndices[32] =
+{
+  0u, 1u, 28u, 2u, 29u, 14u, 24u, 3u, 30u, 22u, 20u, 15u, 25u, 17u, 4u, 8u,
+  31u, 27u, 13u, 23u, 21u, 19u, 16u, 7u, 26u, 12u, 18u, 6u, 11u, 5u, 10u, 9u
+};
+
 /****************************************************************
  * User functions
  ***************************************************************/
@@ -39,6 +92,7 @@ static const GpioIf_ConfigType* GpioIf_userCfg = NULL_PTR;
 void GpioIf_Init(const GpioIf_ConfigType* config)
 {
   /* Local variables */
+  uint8_t i;
   uint8_t port;
   uint8_t pin;
   const GpioIf_PortConfigType* portConfig;
@@ -59,66 +113,65 @@ void GpioIf_Init(const GpioIf_ConfigType* config)
     /* Save user configuration */
     GpioIf_userCfg = config;
 
-    /* Iterate through port configurations */
-    for (port = 0u; port < config->numberOfPorts; port++)
+    /* Iterate through the used pins only */
+    for (i = 0u; i < config->numberOfPins; i++)
     {
+      /* Get pin configuration pointer */
+      pinConfig = &config->pinConfigs[i];
+
+      /* Calculate port and pin */
+      port = (uint8_t) (((uint32_t) pinConfig->channel) / GPIOIF_NUMBER_OF_PINS_PER_CHANNEL);
+      assert_param(port < config->numberOfPorts);
+      pin = (uint8_t) (((uint32_t) pinConfig->channel) % GPIOIF_NUMBER_OF_PINS_PER_CHANNEL);
+
       /* Get port configuration pointer */
       portConfig = &config->portConfigs[port];
-      assert_param(portConfig != NULL_PTR);
-      assert_param(portConfig->pinConfigs != NULL_PTR);
 
-      if (portConfig->portUsed)
-      {
-        /* Enable clock */
-        RCC_AHBPeriphClockCmd(portConfig->clockDomain, ENABLE);
+      /* Enable clock */
+      RCC_AHBPeriphClockCmd(portConfig->clockDomain, ENABLE);
 
-        /* Iterate through pin configurations */
-        for (pin = 0u; pin < portConfig->numberOfPins; pin++)
+      /* Generate configuration structure for GPIO */
+      gpioPinConfig.GPIO_Pin = (uint32_t) (1 << pin);
+      gpioPinConfig.GPIO_Mode = pinConfig->mode;
+      gpioPinConfig.GPIO_Speed = pinConfig->speed;
+      gpioPinConfig.GPIO_OType = pinConfig->outputType;
+      gpioPinConfig.GPIO_PuPd = pinConfig->pullUpDownType;
+
+      /* Initialize port */
+      GPIO_Init(portConfig->registers, &gpioPinConfig);
+      /* Set alternate function, if available */
+      GPIO_PinAFConfig(portConfig->registers, pin,
+                       pinConfig->alternateFunction);
+
+      /* Initialize ISR if necessary */
+      if (pinConfig->isrUsed)
+      {
+        /* Enable SYSCFG's APB interface clock */
+        RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
+
+        /* Connect EXTI to di */
+        SYSCFG_EXTILineConfig(port, pin);
+        assert_param(GpioIf_lineCallbacks[pin] == NULL_PTR);
+        GpioIf_lineCallbacks[pin] = pinConfig->isrCallback;
+        if (pinConfig->captureUsed)
         {
-          /* Get pin configuration pointer */
-          pinConfig = &portConfig->pinConfigs[pin];
-          assert_param(pinConfig != NULL_PTR);
-
-          /* Check if pin is used */
-          if (pinConfig->pinUsed)
-          {
-            /* Generate configuration structure for GPIO */
-            gpioPinConfig.GPIO_Pin = (uint32_t) (1 << pin);
-            gpioPinConfig.GPIO_Mode = pinConfig->mode;
-            gpioPinConfig.GPIO_Speed = pinConfig->speed;
-            gpioPinConfig.GPIO_OType = pinConfig->outputType;
-            gpioPinConfig.GPIO_PuPd = pinConfig->pullUpDownType;
-
-            /* Initialize port */
-            GPIO_Init(portConfig->registers, &gpioPinConfig);
-            /* Set alternate function, if available */
-            GPIO_PinAFConfig(portConfig->registers, pin,
-                             pinConfig->alternateFunction);
-
-            /* Initialize ISR if necessary */
-            if (pinConfig->isrUsed)
-            {
-              /* Enable SYSCFG's APB interface clock */
-              RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
-
-              /* Connect EXTI to di */
-              SYSCFG_EXTILineConfig(port, pin);
-
-              /* Configure di EXTI line */
-              extiConfig.EXTI_Line = (1u << pin);
-              extiConfig.EXTI_Mode = EXTI_Mode_Interrupt;
-              extiConfig.EXTI_Trigger = pinConfig->triggerType;
-              extiConfig.EXTI_LineCmd = ENABLE;
-              EXTI_Init(&extiConfig);
-              /* Clear EXTI line 7 pending bit */
-              EXTI_ClearITPendingBit((1u << pin));
-
-              /* Enable di EXTI interrupt */
-              NVIC_SetPriority(pinConfig->nvicIrq, 3u); /* Lowest priority */
-              NVIC_EnableIRQ(pinConfig->nvicIrq);
-            }
-          }
+          assert_param(config->captureQueue != NULL_PTR);
+          assert_param(config->captureTimestamp != NULL_PTR);
+          GpioIf_lineCaptures[pin] = portConfig->registers;
         }
+
+        /* Configure di EXTI line */
+        extiConfig.EXTI_Line = (1u << pin);
+        extiConfig.EXTI_Mode = EXTI_Mode_Interrupt;
+        extiConfig.EXTI_Trigger = pinConfig->triggerType;
+        extiConfig.EXTI_LineCmd = ENABLE;
+        EXTI_Init(&extiConfig);
+        /* Clear EXTI line pending bit */
+        EXTI_ClearITPendingBit((1u << pin));
+
+        /* Enable di EXTI interrupt */
+        NVIC_SetPriority(GpioIf_lineIrqs[pin], 3u); /* Lowest priority */
+        NVIC_EnableIRQ(GpioIf_lineIrqs[pin]);
       }
     }
   }
@@ -147,13 +200,9 @@ BOOL GpioIf_GetBit(GpioIf_ChannelType channel)
   /* Get port configuration */
   portConfig = &GpioIf_userCfg->portConfigs[port];
   assert_param(portConfig != NULL_PTR);
-  assert_param(pin < portConfig->numberOfPins);
-
-  /* Check if pin is used */
-  assert_param(portConfig->pinConfigs[pin].pinUsed);
 
   /* Depends on the mode which register has to be read */
-  switch (portConfig->pinConfigs[pin].mode)
+  switch (GPIOIF_GET_MODE(portConfig->registers, pin))
   {
   case GPIO_Mode_IN:
     ret = (BOOL) GPIO_ReadInputDataBit(portConfig->registers,
@@ -193,13 +242,9 @@ void GpioIf_SetBit(GpioIf_ChannelType channel)
   /* Get port configuration */
   portConfig = &GpioIf_userCfg->portConfigs[port];
   assert_param(portConfig != NULL_PTR);
-  assert_param(pin < portConfig->numberOfPins);
-
-  /* Check if pin is used */
-  assert_param(portConfig->pinConfigs[pin].pinUsed);
 
   /* Check if the mode is correct */
-  switch (portConfig->pinConfigs[pin].mode)
+  switch (GPIOIF_GET_MODE(portConfig->registers, pin))
   {
   case GPIO_Mode_OUT:
     GPIO_SetBits(portConfig->registers, (uint16_t) (1 << pin));
@@ -231,13 +276,9 @@ void GpioIf_ClrBit(GpioIf_ChannelType channel)
   /* Get port configuration */
   portConfig = &GpioIf_userCfg->portConfigs[port];
   assert_param(portConfig != NULL_PTR);
-  assert_param(pin < portConfig->numberOfPins);
-
-  /* Check if pin is used */
-  assert_param(portConfig->pinConfigs[pin].pinUsed);
 
   /* Check if the mode is correct */
-  switch (portConfig->pinConfigs[pin].mode)
+  switch (GPIOIF_GET_MODE(portConfig->registers, pin))
   {
   case GPIO_Mode_OUT:
     GPIO_ResetBits(portConfig->registers, (uint16_t) (1 << pin));
@@ -250,9 +291,116 @@ void GpioIf_ClrBit(GpioIf_ChannelType channel)
   }
 }
 
-void GpioIf_EnterCS(GpioIf_ChannelType channel)
+void GpioIf_WritePort(GpioIf_PortType port, uint16_t mask, uint16_t value)
+{
+  /* Check configuration structure */
+  assert_param(GpioIf_userCfg != NULL_PTR);
+  assert_param((uint8_t) port < GpioIf_userCfg->numberOfPorts);
+
+  /* Upper half of BSRR resets, lower half sets the pins */
+  GpioIf_userCfg->portConfigs[port].registers->BSRR =
+    ((uint32_t) (mask & (uint16_t) ~value) << 16u) | (uint32_t) (mask & value);
+}
+
+uint16_t GpioIf_ReadPort(GpioIf_PortType port, uint16_t mask)
+{
+  /* Check configuration structure */
+  assert_param(GpioIf_userCfg != NULL_PTR);
+  assert_param((uint8_t) port < GpioIf_userCfg->numberOfPorts);
+
+  return (uint16_t) (GpioIf_userCfg->portConfigs[port].registers->IDR & mask);
+}
+
+void GpioIf_WriteGroup(uint8_t group, uint16_t value)
+{
+  /* Local variables */
+  const GpioIf_PinGroupConfigType* groupConfig;
+
+  /* Check configuration structure */
+  assert_param(GpioIf_userCfg != NULL_PTR);
+  assert_param(group < GpioIf_userCfg->numberOfPinGroups);
+
+  /* Initialize local variables */
+  groupConfig = &GpioIf_userCfg->pinGroups[group];
+
+  GpioIf_WritePort(groupConfig->port, groupConfig->mask,
+                   (uint16_t) (value << groupConfig->shift));
+}
+
+uint16_t GpioIf_ReadGroup(uint8_t group)
+{
+  /* Local variables */
+  const GpioIf_PinGroupConfigType* groupConfig;
+
+  /* Check configuration structure */
+  assert_param(GpioIf_userCfg != NULL_PTR);
+  assert_param(group < GpioIf_userCfg->numberOfPinGroups);
+
+  /* Initialize local variables */
+  groupConfig = &GpioIf_userCfg->pinGroups[group];
+
+  return (uint16_t) (GpioIf_ReadPort(groupConfig->port, groupConfig->mask)
+    >> groupConfig->shift);
+}
+
+uint8_t GpioIf_ReadCaptures(GpioIf_CaptureEntryType* entries,
+                            uint8_t maxEntries)
+{
+  /* Local variables */
+  uint8_t i;
+  uint8_t count;
+  uint8_t rdIdx;
+  GpioIf_CaptureQueueType* queue;
+
+  /* Initialize local variables */
+  count = 0u;
+
+  assert_param(entries != NULL_PTR);
+
+  if ((GpioIf_userCfg != NULL_PTR) && (GpioIf_userCfg->captureQueue != NULL_PTR))
+  {
+    queue = GpioIf_userCfg->captureQueue;
+    rdIdx = queue->rdIdx;
+
+    /* The write counter is read once, later edges stay for the next call */
+    count = (uint8_t) (queue->wrIdx - rdIdx);
+    if (count > maxEntries)
+      count = maxEntries;
+
+    for (i = 0u; i < count; i++)
+    {
+      entries[i] = queue->entries[rdIdx & (queue->size - 1u)];
+      rdIdx++;
+    }
+
+    /* Release the entries after they were copied */
+    __DMB();
+    queue->rdIdx = rdIdx;
+  }
+
+  return count;
+}
+
+uint8_t GpioIf_GetCaptureOverflows(void)
 {
   /* Local variables */
+  uint8_t ret;
+
+  /* Initialize local variables */
+  ret = 0u;
+
+  if ((GpioIf_userCfg != NULL_PTR) && (GpioIf_userCfg->captureQueue != NULL_PTR))
+  {
+    ret = GpioIf_userCfg->captureQueue->overflows;
+  }
+
+  return ret;
+}
+
+GpioIf_HandleType GpioIf_GetHandle(GpioIf_ChannelType channel)
+{
+  /* Local variables */
+  GpioIf_HandleType handle;
   uint8_t port;
   uint8_t pin;
   const GpioIf_PortConfigType* portConfig;
@@ -269,44 +417,45 @@ void GpioIf_EnterCS(GpioIf_ChannelType channel)
   /* Get port configuration */
   portConfig = &GpioIf_userCfg->portConfigs[port];
   assert_param(portConfig != NULL_PTR);
-  assert_param(pin < portConfig->numberOfPins);
 
-  /* Check if pin is used */
-  assert_param(portConfig->pinConfigs[pin].pinUsed);
+  /* Generate handle */
+  handle.registers = portConfig->registers;
+  handle.mask = (uint16_t) (1 << pin);
+
+  return handle;
+}
+
+void GpioIf_EnterCS(GpioIf_ChannelType channel)
+{
+  /* Local variables */
+  uint8_t pin;
+
+  /* Check configuration structure */
+  assert_param(GpioIf_userCfg != NULL_PTR);
 
-  if (portConfig->pinConfigs[pin].isrUsed)
+  /* Calculate pin, the EXTI line is shared by the pins of all ports */
+  pin = (uint8_t) (((uint32_t) channel) % GPIOIF_NUMBER_OF_PINS_PER_CHANNEL);
+
+  if ((EXTI->IMR & (1u << pin)) != 0u)
   {
-    NVIC_DisableIRQ(portConfig->pinConfigs[pin].nvicIrq);
+    NVIC_DisableIRQ(GpioIf_lineIrqs[pin]);
   }
 }
 
 void GpioIf_LeaveCS(GpioIf_ChannelType channel)
 {
   /* Local variables */
-  uint8_t port;
   uint8_t pin;
-  const GpioIf_PortConfigType* portConfig;
 
   /* Check configuration structure */
   assert_param(GpioIf_userCfg != NULL_PTR);
 
-  /* Calculate port and pin */
-  port = (uint8_t) (((uint32_t) channel) / GPIOIF_NUMBER_OF_PINS_PER_CHANNEL);
-  assert_param(port < GpioIf_userCfg->numberOfPorts);
+  /* Calculate pin, the EXTI line is shared by the pins of all ports */
   pin = (uint8_t) (((uint32_t) channel) % GPIOIF_NUMBER_OF_PINS_PER_CHANNEL);
-  assert_param(pin < GPIOIF_NUMBER_OF_PINS_PER_CHANNEL);
-
-  /* Get port configuration */
-  portConfig = &GpioIf_userCfg->portConfigs[port];
-  assert_param(portConfig != NULL_PTR);
-  assert_param(pin < portConfig->numberOfPins);
-
-  /* Check if pin is used */
-  assert_param(portConfig->pinConfigs[pin].pinUsed);
 
-  if (portConfig->pinConfigs[pin].isrUsed)
+  if ((EXTI->IMR & (1u << pin)) != 0u)
   {
-    NVIC_EnableIRQ(portConfig->pinConfigs[pin].nvicIrq);
+    NVIC_EnableIRQ(GpioIf_lineIrqs[pin]);
   }
 }
 
@@ -315,30 +464,51 @@ void GpioIf_LeaveCS(GpioIf_ChannelType channel)
  ***************************************************************/
 
 void GpioIf_Isr(uint8_t line)
+{
+  /* Check parameters */
+  if (line < GPIOIF_NUMBER_OF_PINS_PER_CHANNEL)
+  {
+    GpioIf_IsrLines(1u << line);
+  }
+}
+
+void GpioIf_IsrLines(uint32_t lines)
 {
   /* Local variables */
-  uint8_t i;
-  const GpioIf_PinConfigType* pinConfig;
+  uint32_t bit;
+  uint8_t line;
+  uint32_t timestamp;
+  GpioIf_IsrCallbackType callback;
 
   /* Initialize local variables */
-  i = 0u;
+  timestamp = 0u;
+
+  /* Only lines of pins are dispatched */
+  lines &= (1u << GPIOIF_NUMBER_OF_PINS_PER_CHANNEL) - 1u;
+
+  /* One timestamp for all lines of this interrupt, taken first */
+  if ((lines != 0u) && (GpioIf_userCfg != NULL_PTR)
+    && (GpioIf_userCfg->captureTimestamp != NULL_PTR))
+  {
+    timestamp = GpioIf_userCfg->captureTimestamp();
+  }
 
-  /* Check parameters and configuration */
-  if ((line < GPIOIF_NUMBER_OF_PINS_PER_CHANNEL)
-    && (GpioIf_userCfg != NULL_PTR))
+  /* Iterate through the set bits, lowest line first */
+  while (lines != 0u)
   {
-    /* Iterate through ports and call callback function for ISR handling */
-    for (i = 0u; i < GpioIf_userCfg->numberOfPorts; i++)
+    bit = lines & (0u - lines);
+    lines &= ~bit;
+    line = GPIOIF_BIT_INDEX(bit);
+
+    if (GpioIf_lineCaptures[line] != NULL_PTR)
     {
-      /* Get pointer to the pin configuration */
-      pinConfig = &GpioIf_userCfg->portConfigs[i].pinConfigs[line];
+      GpioIf_Capture(line, timestamp);
+    }
 
-      /* Check if ISR is used and ISR callback is set */
-      if (pinConfig->isrUsed && (pinConfig->isrCallback != NULL_PTR))
-      {
-        /* Call ISR callback */
-        pinConfig->isrCallback();
-      }
+    callback = GpioIf_lineCallbacks[line];
+    if (callback != NULL_PTR)
+    {
+      callback();
     }
   }
 }
@@ -346,3 +516,31 @@ void GpioIf_Isr(uint8_t line)
 /****************************************************************
  * Static functions
  ***************************************************************/
+
+static void GpioIf_Capture(uint8_t line, uint32_t timestamp)
+{
+  /* Local variables */
+  uint8_t wrIdx;
+  GpioIf_CaptureQueueType* queue;
+  GpioIf_CaptureEntryType* entry;
+
+  /* Initialize local variables */
+  queue = GpioIf_userCfg->captureQueue;
+  wrIdx = queue->wrIdx;
+
+  if ((uint8_t) (wrIdx - queue->rdIdx) < queue->size)
+  {
+    entry = &queue->entries[wrIdx & (queue->size - 1u)];
+    entry->timestamp = timestamp;
+    entry->line = line;
+    entry->level = (BOOL) ((GpioIf_lineCaptures[line]->IDR & (1u << line)) != 0u);
+
+    /* Publish the entry after it was written */
+    __DMB();
+    queue->wrIdx = (uint8_t) (wrIdx + 1u);
+  }
+  else
+  {
+    queue->overflows++;
+  }
+}
@@ -150,13 +150,12 @@ typedef void (*GpioIf_IsrCallbackType)(void);
 typedef IRQn_Type GpioIf_NvicIrqType;
 
 /**
- * Represents one pin configuration.
+ * Represents one pin configuration. Only used pins are configured.
  */
 typedef struct
 {
-  /* Determines if this channel should be initialized.
-   * TRUE means that this pin will be initialized; otherwise FALSE. */
-  const BOOL pinUsed;
+  /* The channel (port and pin) to initialize. */
+  const GpioIf_ChannelType channel;
   /* Pin mode. */
   const GpioIf_ModeType mode;
   /* Pin speed. */
@@ -169,12 +168,12 @@ typedef struct
   const GpioIf_AlternateFunctionType alternateFunction;
   /* Determines if this channel should use the ISR. */
   const BOOL isrUsed;
-  /* Defines the NVIC interrupt. */
-  const GpioIf_NvicIrqType nvicIrq;
   /* Defines the ISR callback. */
   const GpioIf_IsrCallbackType isrCallback;
   /* Defines the trigger mode. */
   const GpioIf_ExternalInterruptTriggerType triggerType;
+  /* Determines if edges are recorded in the capture queue (needs isrUsed). */
+  const BOOL captureUsed;
 } GpioIf_PinConfigType;
 
 /**
@@ -182,19 +181,73 @@ typedef struct
  */
 typedef struct
 {
-  /* Determines if this port should be initialized.
-   * TRUE means that this pin will be initialized; otherwise FALSE. */
-  const BOOL portUsed;
-  /* Defines the number of pins per port. */
-  const uint8_t numberOfPins;
-  /* A pointer to the pin configurations. */
-  const GpioIf_PinConfigType* pinConfigs;
   /* The port registers. */
   GpioIf_RegisterType* registers;
   /* The clock domain. */
   const GpioIf_ClockDomainType clockDomain;
 } GpioIf_PortConfigType;
 
+/**
+ * Precomputed pin handle. Accesses through a handle need neither the
+ *  configuration nor a division, they compile to a single load or store.
+ */
+typedef struct
+{
+  /* The port registers. */
+  GpioIf_RegisterType* registers;
+  /* The pin mask. */
+  uint16_t mask;
+} GpioIf_HandleType;
+
+/**
+ * Represents a group of pins of one port, which are written and read
+ *  together (e.g. a parallel bus or a multiplexer address).
+ */
+typedef struct
+{
+  /* The port of the pins. */
+  const GpioIf_PortType port;
+  /* The pins of the group. */
+  const uint16_t mask;
+  /* Position of the lowest pin, group values are shifted by it. */
+  const uint8_t shift;
+} GpioIf_PinGroupConfigType;
+
+/**
+ * Defines a function returning a free running timestamp.
+ */
+typedef uint32_t (*GpioIf_TimestampType)(void);
+
+/**
+ * One recorded edge.
+ */
+typedef struct
+{
+  /* The timestamp of the interrupt. */
+  uint32_t timestamp;
+  /* The EXTI line (pin number). */
+  uint8_t line;
+  /* The pin level read in the interrupt. */
+  BOOL level;
+} GpioIf_CaptureEntryType;
+
+/**
+ * Queue of recorded edges. Written by the interrupt and read by the main
+ *  loop only, so no critical section is needed.
+ */
+typedef struct
+{
+  /* A pointer to the entries. */
+  GpioIf_CaptureEntryType* const entries;
+  /* Defines the number of entries, a power of 2. */
+  const uint8_t size;
+  /* Free running write and read counters. */
+  volatile uint8_t wrIdx;
+  volatile uint8_t rdIdx;
+  /* Edges lost because the queue was full, written by the interrupt only. */
+  volatile uint8_t overflows;
+} GpioIf_CaptureQueueType;
+
 /**
  * Represents the GpioIf configuration.
  */
@@ -204,6 +257,18 @@ typedef struct
   const uint8_t numberOfPorts;
   /* A pointer to the port configurations. */
   const GpioIf_PortConfigType* portConfigs;
+  /* Defines the number of used pins. */
+  const uint8_t numberOfPins;
+  /* A pointer to the pin configurations. */
+  const GpioIf_PinConfigType* pinConfigs;
+  /* Defines the number of pin groups. */
+  const uint8_t numberOfPinGroups;
+  /* A pointer to the pin group configurations. */
+  const GpioIf_PinGroupConfigType* pinGroups;
+  /* The edge capture queue, NULL_PTR if unused. */
+  GpioIf_CaptureQueueType* const captureQueue;
+  /* The timestamp source of captured edges. */
+  const GpioIf_TimestampType captureTimestamp;
 } GpioIf_ConfigType;
 
 /****************************************************************
@@ -215,6 +280,52 @@ typedef struct
  */
 #define GPIOIF_NUMBER_OF_PINS_PER_CHANNEL                     16u
 
+/**
+ * Gets the registers of a port, the ports are mapped in equal distances.
+ * @param port The port number.
+ */
+#define GPIOIF_PORT_REGISTERS(port)                                            \
+  ((GpioIf_RegisterType*) (GPIOA_BASE                                          \
+    + (uint32_t) (port) * (GPIOB_BASE - GPIOA_BASE)))
+
+/**
+ * Compile time initializer of a pin handle.
+ * @param channel The channel of the pin.
+ */
+#define GPIOIF_HANDLE(channel)                                                 \
+  {                                                                            \
+    GPIOIF_PORT_REGISTERS((uint32_t) (channel) / GPIOIF_NUMBER_OF_PINS_PER_CHANNEL), \
+    (uint16_t) (1u << ((uint32_t) (channel) % GPIOIF_NUMBER_OF_PINS_PER_CHANNEL)) \
+  }
+
+/**
+ * Sets an output pin (single BSRR store).
+ * @param handle The pin handle.
+ */
+#define GpioIf_HandleSet(handle)          ((handle).registers->BSRR = (handle).mask)
+
+/**
+ * Clears an output pin (single BRR store).
+ * @param handle The pin handle.
+ */
+#define GpioIf_HandleClr(handle)          ((handle).registers->BRR = (handle).mask)
+
+/**
+ * Gets the input state of a pin (single IDR load).
+ * @param handle The pin handle.
+ * @return TRUE if the pin is High; otherwise FALSE.
+ */
+#define GpioIf_HandleGet(handle)                                               \
+  ((BOOL) (((handle).registers->IDR & (handle).mask) != 0u))
+
+/**
+ * Gets the output state of a pin (single ODR load).
+ * @param handle The pin handle.
+ * @return TRUE if the pin is set; otherwise FALSE.
+ */
+#define GpioIf_HandleGetOutput(handle)                                         \
+  ((BOOL) (((handle).registers->ODR & (handle).mask) != 0u))
+
 /****************************************************************
  * Global variables
  ***************************************************************/
@@ -235,7 +346,8 @@ extern const GpioIf_ConfigType GpioIf_config;
 void GpioIf_Init(const GpioIf_ConfigType* config);
 
 /**
- * Gets the pin state.
+ * Gets the pin state, the input state for input pins and the output state
+ *  for output pins.
  * @param channel The channel of the pin.
  * @return TRUE if the pin is High; otherwise FALSE.
  */
@@ -253,6 +365,60 @@ void GpioIf_SetBit(GpioIf_ChannelType channel);
  */
 void GpioIf_ClrBit(GpioIf_ChannelType channel);
 
+/**
+ * Writes several output pins of one port at once. All pins change with a
+ *  single BSRR store, independent of the number of pins.
+ * @param port The port of the pins.
+ * @param mask The pins to write.
+ * @param value The new pin states, only bits within mask are used.
+ */
+void GpioIf_WritePort(GpioIf_PortType port, uint16_t mask, uint16_t value);
+
+/**
+ * Reads several pins of one port at once.
+ * @param port The port of the pins.
+ * @param mask The pins to read.
+ * @return The input states of the pins within mask.
+ */
+uint16_t GpioIf_ReadPort(GpioIf_PortType port, uint16_t mask);
+
+/**
+ * Writes a pin group with a single BSRR store.
+ * @param group The pin group number.
+ * @param value The new group value, bit 0 is the lowest pin of the group.
+ */
+void GpioIf_WriteGroup(uint8_t group, uint16_t value);
+
+/**
+ * Reads a pin group.
+ * @param group The pin group number.
+ * @return The group value, bit 0 is the lowest pin of the group.
+ */
+uint16_t GpioIf_ReadGroup(uint8_t group);
+
+/**
+ * Takes the recorded edges out of the capture queue, oldest first.
+ * @param entries Destination of the edges.
+ * @param maxEntries Maximum number of edges to take.
+ * @return The number of edges copied.
+ */
+uint8_t GpioIf_ReadCaptures(GpioIf_CaptureEntryType* entries,
+                            uint8_t maxEntries);
+
+/**
+ * Gets the number of edges lost because the queue was full.
+ * @return The free running (wrapping) number of lost edges.
+ */
+uint8_t GpioIf_GetCaptureOverflows(void);
+
+/**
+ * Resolves the handle of a pin at runtime, with the checks of the channel
+ *  based functions (debug builds).
+ * @param channel The channel of the pin.
+ * @return The pin handle.
+ */
+GpioIf_HandleType GpioIf_GetHandle(GpioIf_ChannelType channel);
+
 /**
  * Enters a critical section.
  * @param channel The critical channel.
@@ -274,4 +440,11 @@ void GpioIf_LeaveCS(GpioIf_ChannelType channel);
  */
 void GpioIf_Isr(uint8_t line);
 
+/**
+ * Interrupt service routine of several lines, calls the callbacks of the
+ *  set lines only.
+ * @param lines The pending lines (bit n for line n).
+ */
+void GpioIf_IsrLines(uint32_t lines);
+
 #endif /* GPIOIF_H */
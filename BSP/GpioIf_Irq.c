@@ -22,6 +22,25 @@
  * Macros
  ***************************************************************/
 
+/**
+ * EXTI lines of the IRQ handlers.
+ */
+#define GPIOIF_IRQ_LINES_0_1            0x0003u
+#define GPIOIF_IRQ_LINES_2_3            0x000Cu
+#define GPIOIF_IRQ_LINES_4_15           0xFFF0u
+
+/**
+ * Reads the pending and enabled lines of an IRQ handler once and clears
+ *  them before dispatching, so edges during the callbacks are not lost.
+ */
+#define GPIOIF_IRQ_DISPATCH(lineMask)                                          \
+  do                                                                           \
+  {                                                                            \
+    uint32_t pending = EXTI->PR & EXTI->IMR & (lineMask);                      \
+    EXTI->PR = pending;                                                        \
+    GpioIf_IsrLines(pending);                                                  \
+  } while (0)
+
 /****************************************************************
  * Function declarations
  ***************************************************************/
@@ -49,65 +68,17 @@ void EXTI4_15_IRQHandler(void);
 
 void EXTI0_1_IRQHandler(void)
 {
-  /* Local variables */
-  uint8_t i;
-  uint32_t line;
-
-  /* Initialize local variables */
-  line = 0u;
-
-  for (i = 0u; i < 2u; i++)
-  {
-    line = 1u << i;
-
-    if (EXTI_GetITStatus(line) == SET)
-    {
-      GpioIf_Isr(i);
-      EXTI_ClearITPendingBit(line);
-    }
-  }
+  GPIOIF_IRQ_DISPATCH(GPIOIF_IRQ_LINES_0_1);
 }
 
 void EXTI2_3_IRQHandler(void)
 {
-  /* Local variables */
-  uint8_t i;
-  uint32_t line;
-
-  /* Initialize local variables */
-  line = 0u;
-
-  for (i = 2u; i < 4u; i++)
-  {
-    line = 1u << i;
-
-    if (EXTI_GetITStatus(line) == SET)
-    {
-      GpioIf_Isr(i);
-      EXTI_ClearITPendingBit(line);
-    }
-  }
+  GPIOIF_IRQ_DISPATCH(GPIOIF_IRQ_LINES_2_3);
 }
 
 void EXTI4_15_IRQHandler(void)
 {
-  /* Local variables */
-  uint8_t i;
-  uint32_t line;
-
-  /* Initialize local variables */
-  line = 0u;
-
-  for (i = 4u; i < 16u; i++)
-  {
-    line = 1u << i;
-
-    if (EXTI_GetITStatus(line) == SET)
-    {
-      GpioIf_Isr(i);
-      EXTI_ClearITPendingBit(line);
-    }
-  }
+  GPIOIF_IRQ_DISPATCH(GPIOIF_IRQ_LINES_4_15);
 }
 
 /****************************************************************
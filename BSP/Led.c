@@ -25,9 +25,15 @@
  * Function declarations
  ***************************************************************/
 
-static BOOL Led_GetValue(const uint8_t channel);
-static void Led_SwitchOn(const uint8_t channel);
-static void Led_SwitchOff(const uint8_t channel);
+/**
+ * Sets period and duty cycle of a Led timer and restarts it.
+ * @param channelConfig The Led.
+ * @param period The period in ms, 1 ... LED_MAX_PERIOD.
+ * @param duty The duty cycle.
+ * @return TRUE if the operation succeeded; otherwise FALSE.
+ */
+static BOOL Led_SetTimer(const Led_ChannelConfigType* channelConfig,
+                         const uint32_t period, const TimerIf_DutyType duty);
 
 /****************************************************************
  * Global variables
@@ -102,11 +108,15 @@ BOOL Led_BlinkOnOffTime(const uint8_t channel, const uint32_t onTime,
 {
   /* Local variables */
   BOOL ret;
-  Led_ChannelConfigType* channelConfig;
+  const Led_ChannelConfigType* channelConfig;
+  uint32_t period;
+  TimerIf_DutyType duty;
 
   /* Initialize local variables */
   ret = FALSE;
   channelConfig = NULL_PTR;
+  period = 0u;
+  duty = 0u;
 
   /* Check configuration */
   if ((Led_userCfg != NULL_PTR) && (channel < Led_userCfg->numberOfLeds)
@@ -114,48 +124,28 @@ BOOL Led_BlinkOnOffTime(const uint8_t channel, const uint32_t onTime,
   {
     channelConfig = &Led_userCfg->channelConfigs[channel];
 
-    channelConfig->onTime = onTime;
-    channelConfig->offTime = offTime;
-
-    ret = TRUE;
-  }
-
-  return ret;
-}
-
-void Led_MsTimer(void)
-{
-  /* Local variables */
-  uint8_t channel;
-  Led_ChannelConfigType* channelConfig;
-
-  /* Initialize local variables */
-  channel = 0u;
-  channelConfig = NULL_PTR;
-
-  /* Check configuration */
-  if (Led_userCfg != NULL_PTR)
-  {
-    for (channel = 0u; channel < Led_userCfg->numberOfLeds; channel++)
+    if (offTime == 0u)
+    {
+      /* Steady on, any period */
+      ret = Led_SetTimer(channelConfig, LED_MAX_PERIOD, TIMERIF_DUTY_MAX);
+    }
+    else if (onTime == 0u)
     {
-      channelConfig = &Led_userCfg->channelConfigs[channel];
-
-      channelConfig->currentTime++;
-      if ((Led_GetValue(channel) == TRUE)
-        && (channelConfig->currentTime > channelConfig->onTime))
-      {
-        /* Reset time */
-        channelConfig->currentTime = 0u;
-        Led_SwitchOff(channel);
-      }
-      else if ((Led_GetValue(channel) == FALSE)
-        && (channelConfig->currentTime > channelConfig->offTime))
-      {
-        channelConfig->currentTime = 0u;
-        Led_SwitchOn(channel);
-      }
+      /* Steady off */
+      ret = Led_SetTimer(channelConfig, LED_MAX_PERIOD, 0u);
+    }
+    else if ((onTime < LED_MAX_PERIOD) && (offTime < LED_MAX_PERIOD)
+      && ((onTime + offTime) <= LED_MAX_PERIOD))
+    {
+      period = onTime + offTime;
+      /* Round up, so the on time is never shortened to zero */
+      duty = (TimerIf_DutyType) ((((uint64_t) onTime * TIMERIF_DUTY_MAX)
+        + period - 1u) / period);
+      ret = Led_SetTimer(channelConfig, period, duty);
     }
   }
+
+  return ret;
 }
 
 /****************************************************************
@@ -166,46 +156,30 @@ void Led_MsTimer(void)
  * Static functions
  ***************************************************************/
 
-static BOOL Led_GetValue(const uint8_t channel)
+static BOOL Led_SetTimer(const Led_ChannelConfigType* channelConfig,
+                         const uint32_t period, const TimerIf_DutyType duty)
 {
   /* Local variables */
   BOOL ret;
-  const Led_ChannelConfigType* channelConfig;
-
-  /* Initialize local variables */
-  channelConfig = &Led_userCfg->channelConfigs[channel];
-  ret = !channelConfig->activeHigh;
-
-  if (GpioIf_GetBit(channelConfig->gpioChannel))
-    ret = channelConfig->activeHigh;
-
-  return ret;
-}
-
-static void Led_SwitchOn(const uint8_t channel)
-{
-  /* Local variables */
-  const Led_ChannelConfigType* channelConfig;
 
   /* Initialize local variables */
-  channelConfig = &Led_userCfg->channelConfigs[channel];
+  ret = FALSE;
 
-  if (channelConfig->activeHigh)
-    GpioIf_SetBit(channelConfig->gpioChannel);
-  else
-    GpioIf_ClrBit(channelConfig->gpioChannel);
-}
+  /* The period can only be changed while the timer is stopped, the duty
+   * cycle is loaded at once then and the new period starts with the Led on */
+  ret = TimerIf_Stop(channelConfig->timerChannel);
 
-static void Led_SwitchOff(const uint8_t channel)
-{
-  /* Local variables */
-  const Led_ChannelConfigType* channelConfig;
+  if (ret)
+  {
+    ret = TimerIf_SetFreqPeriod(channelConfig->timerChannel,
+                                LED_TIMER_FREQUENCY, period - 1u);
+  }
 
-  /* Initialize local variables */
-  channelConfig = &Led_userCfg->channelConfigs[channel];
+  if (ret)
+  {
+    ret = TimerIf_SetDuty(channelConfig->pwm, duty);
+    TimerIf_Start(channelConfig->timerChannel);
+  }
 
-  if (channelConfig->activeHigh)
-    GpioIf_ClrBit(channelConfig->gpioChannel);
-  else
-    GpioIf_SetBit(channelConfig->gpioChannel);
+  return ret;
 }
@@ -16,21 +16,21 @@
 
 #include "Services/StdDef.h"
 
-#include "GpioIf.h"
+#include "TimerIf.h"
 
+/**
+ * Led on a PWM output, the timer channel is used by this Led only.
+ */
 typedef struct
 {
-  const GpioIf_ChannelType gpioChannel;
-  const BOOL activeHigh;
-  uint32_t onTime;
-  uint32_t offTime;
-  uint32_t currentTime;
+  const uint8_t timerChannel;
+  const uint8_t pwm;
 } Led_ChannelConfigType;
 
 typedef struct
 {
   const uint8_t numberOfLeds;
-  Led_ChannelConfigType* channelConfigs;
+  const Led_ChannelConfigType* channelConfigs;
 } Led_ConfigType;
 
 /****************************************************************
@@ -41,6 +41,16 @@ typedef struct
  * Macros                                                       *
  ***************************************************************/
 
+/**
+ * Counting frequency of the Led timers, 1 ms resolution.
+ */
+#define LED_TIMER_FREQUENCY                                   1000u
+
+/**
+ * Longest blink period in ms (16 bit timer).
+ */
+#define LED_MAX_PERIOD                                        0x10000u
+
 /****************************************************************
  * Global variables
  ***************************************************************/
@@ -51,12 +61,27 @@ extern const Led_ConfigType Led_config;
  * User functions
  ***************************************************************/
 
+/**
+ * Initialize the Leds and turn them off. TimerIf has to be initialized
+ *  before.
+ * @param config Pointer to the configuration.
+ */
 void Led_Init(const Led_ConfigType* config);
 
 BOOL Led_TurnOn(const uint8_t channel);
 BOOL Led_TurnOff(const uint8_t channel);
 BOOL Led_BlinkDuty(const uint8_t channel, const uint32_t duty,
                    const uint32_t period);
+
+/**
+ * Blinks a Led, the timer toggles it without software. A zero on or off
+ *  time turns the Led off or on.
+ * @param channel The Led.
+ * @param onTime The on time in ms.
+ * @param offTime The off time in ms, on and off time together at most
+ *  LED_MAX_PERIOD.
+ * @return TRUE if the operation succeeded; otherwise FALSE.
+ */
 BOOL Led_BlinkOnOffTime(const uint8_t channel, const uint32_t onTime,
                         const uint32_t offTime);
 
@@ -64,6 +89,4 @@ BOOL Led_BlinkOnOffTime(const uint8_t channel, const uint32_t onTime,
  * Internal functions/callbacks
  ***************************************************************/
 
-void Led_MsTimer(void);
-
 #endif
@@ -14,8 +14,6 @@
 #include "Led.h"
 #include "Led_Cfg.h"
 
-#include "GpioIf.h"
-
 /****************************************************************
  * Type definitions
  ***************************************************************/
@@ -32,22 +30,19 @@
  * Global variables
  ***************************************************************/
 
-static Led_ChannelConfigType Led_channelConfigs[LED_NUMBER_OF_CHANNELS] =
+static const Led_ChannelConfigType Led_channelConfigs[LED_NUMBER_OF_CHANNELS] =
 {
   {
-    LED_GPIO_CHANNEL0,
-    LED_GPIO_ACTIVE_HIGH0,
-    0u, 0u, 0u
+    LED_TIMER_CHANNEL0,
+    LED_PWM0
   },
   {
-    LED_GPIO_CHANNEL1,
-    LED_GPIO_ACTIVE_HIGH1,
-    0u, 0u, 0u
+    LED_TIMER_CHANNEL1,
+    LED_PWM1
   },
   {
-    LED_GPIO_CHANNEL2,
-    LED_GPIO_ACTIVE_HIGH2,
-    0u, 0u, 0u
+    LED_TIMER_CHANNEL2,
+    LED_PWM2
   }
 };
 
@@ -27,17 +27,17 @@
 /* Generic settings */
 #define LED_NUMBER_OF_CHANNELS                                3u
 
-/* Channel 0 */
-#define LED_GPIO_CHANNEL0                                     GpioIf_ChannelA07
-#define LED_GPIO_ACTIVE_HIGH0                                 FALSE
+/* Channel 0 (TimerIf channel and PWM, see TimerIf_Cfg.h) */
+#define LED_TIMER_CHANNEL0                                    1u
+#define LED_PWM0                                              0u
 
 /* Channel 1 */
-#define LED_GPIO_CHANNEL1                                     GpioIf_ChannelB01
-#define LED_GPIO_ACTIVE_HIGH1                                 FALSE
+#define LED_TIMER_CHANNEL1                                    2u
+#define LED_PWM1                                              1u
 
 /* Channel 2 */
-#define LED_GPIO_CHANNEL2                                     GpioIf_ChannelB00
-#define LED_GPIO_ACTIVE_HIGH2                                 FALSE
+#define LED_TIMER_CHANNEL2                                    3u
+#define LED_PWM2                                              2u
 
 /****************************************************************
  * Global variables
@@ -42,9 +42,26 @@ static const Rs485_ConfigType* Rs485_userConfig = NULL_PTR;
 
 void Rs485_Init(const Rs485_ConfigType* config)
 {
+  /* Local variables */
+  uint8_t i = 0;
+  uint8_t uartChannel = 0;
+
   /* Check config parameter and current config */
   if ((config != NULL_PTR) && (Rs485_userConfig == NULL_PTR))
   {
+    /* Invalidate all entries of the lookup table */
+    for (i = 0; i < config->numberOfUartifChannels; i++)
+      config->uartifChannelLookup[i] = RS485_CHANNEL_INVALID;
+
+    /* Resolve the reverse mapping once, so the ISRs don't have to search */
+    for (i = 0; i < config->numberOfChannels; i++)
+    {
+      uartChannel = config->channelConfig[i].uartifChannelNumber;
+
+      if (uartChannel < config->numberOfUartifChannels)
+        config->uartifChannelLookup[uartChannel] = i;
+    }
+
     /* Save config struct */
     Rs485_userConfig = config;
   }
@@ -176,18 +193,14 @@ static BOOL Rs485_GetRs485Channel(const uint8_t uartChannel,
   uint8_t* rs485Channel)
 {
   /* Locale variables */
-  uint8_t i = 0;
   BOOL ret = FALSE;
 
-  /* find rs485 channel */
-  for (; i < Rs485_userConfig->numberOfChannels; i++)
-    /* check channel */
-    if (Rs485_userConfig->channelConfig[i].uartifChannelNumber == uartChannel)
-    {
-      *rs485Channel = i;
-      ret = TRUE;
-      break;
-    }
+  /* look up rs485 channel */
+  if (uartChannel < Rs485_userConfig->numberOfUartifChannels)
+  {
+    *rs485Channel = Rs485_userConfig->uartifChannelLookup[uartChannel];
+    ret = (*rs485Channel != RS485_CHANNEL_INVALID);
+  }
 
   return ret;
 }
@@ -68,6 +68,16 @@ typedef struct
    * Array of all channel configs
    */
   const Rs485_ChannelConfigType* channelConfig;
+
+  /**
+   * Number of entries in the UartIf channel lookup table
+   */
+  const uint8_t numberOfUartifChannels;
+
+  /**
+   * Lookup table from UartIf channel to Rs485 channel, filled at init
+   */
+  uint8_t* uartifChannelLookup;
 }
 Rs485_ConfigType;
 
@@ -75,6 +85,11 @@ Rs485_ConfigType;
  * Macros                                                       *
  ***************************************************************/
 
+/**
+ * Marks an UartIf channel without assigned Rs485 channel in the lookup table
+ */
+#define RS485_CHANNEL_INVALID         0xFFu
+
 /****************************************************************
  * Global variables
  ***************************************************************/
@@ -16,6 +16,7 @@
 #include "Rs485.h"
 #include "Rs485_Cfg.h"
 #include "GpioIf.h"
+#include "UartIf_Cfg.h"
 #include "Services/StdDef.h"
 
 /****************************************************************
@@ -34,6 +35,8 @@
  * Global variables
  ***************************************************************/
 
+static uint8_t Rs485_UartifChannelLookup[UARTIF_NUMBER_OF_CHANNELS];
+
 static const Rs485_ChannelConfigType Rs485_ChannelConfigs[RS485_NUMBER_OF_CHANNELS] = 
 {
   {
@@ -48,7 +51,9 @@ static const Rs485_ChannelConfigType Rs485_ChannelConfigs[RS485_NUMBER_OF_CHANNE
 const Rs485_ConfigType Rs485_config =
 {
   RS485_NUMBER_OF_CHANNELS,
-  Rs485_ChannelConfigs
+  Rs485_ChannelConfigs,
+  UARTIF_NUMBER_OF_CHANNELS,
+  Rs485_UartifChannelLookup
 };
 
 /****************************************************************
@@ -13,6 +13,7 @@
 
 #include "SpiIf.h"
 
+#include "stm32f0xx_dma.h"
 #include "stm32f0xx_rcc.h"
 
 /****************************************************************
@@ -38,20 +39,64 @@ typedef void (*SpiIf_PeriphClockCmd)(uint32_t, FunctionalState);
   SpiIf_clockCmds[SpiIf_userCfg->channelConfigs[(channel)].spiChannelNumber - 1u] \
     (SPIIF_GET_CLOCK_DOMAIN(channel), newState)
 
+#define SPIIF_GET_DMA_RX(channel)                               \
+  SpiIf_dmaRxChannels[SpiIf_userCfg->channelConfigs[(channel)].spiChannelNumber - 1u]
+
+#define SPIIF_GET_DMA_TX(channel)                               \
+  SpiIf_dmaTxChannels[SpiIf_userCfg->channelConfigs[(channel)].spiChannelNumber - 1u]
+
+#define SPIIF_GET_DMA_NVIC(channel)                             \
+  SpiIf_dmaNvics[SpiIf_userCfg->channelConfigs[(channel)].spiChannelNumber - 1u]
+
+#define SPIIF_GET_DMA_RX_TC(channel)                            \
+  SpiIf_dmaRxTcFlags[SpiIf_userCfg->channelConfigs[(channel)].spiChannelNumber - 1u]
+
+#define SPIIF_GET_DMA_FLAGS(channel)                            \
+  SpiIf_dmaFlags[SpiIf_userCfg->channelConfigs[(channel)].spiChannelNumber - 1u]
+
+#define SPIIF_GET_CURRENT_DEVICE(channel)                       \
+  SpiIf_currentDevices[SpiIf_userCfg->channelConfigs[(channel)].spiChannelNumber - 1u]
+
+/* Items wider than 8 bit are stored as two bytes (little endian) */
+#define SPIIF_GET_FRAME_BYTES(job)                              \
+  (((job)->device->dataSize > SPI_DataSize_8b) ? 2u : 1u)
+
+/* Bytes which may be on their way without overrunning the 32 bit RX FIFO */
+#define SPIIF_FIFO_SIZE                                         4u
+
+/* The critical section locks the interrupt which drives the job queue */
+#define SPIIF_GET_QUEUE_NVIC(channel)                           \
+  (SpiIf_userCfg->channelConfigs[(channel)].dmaUsed ?           \
+    SPIIF_GET_DMA_NVIC(channel) : SPIIF_GET_NVIC(channel))
+
 #define SPIIF_ENTER_CS(channel)                                 \
-  NVIC_DisableIRQ(SPIIF_GET_NVIC(channel))
+  NVIC_DisableIRQ(SPIIF_GET_QUEUE_NVIC(channel))
 
 #define SPIIF_LEAVE_CS(channel)                                 \
-  NVIC_EnableIRQ(SPIIF_GET_NVIC(channel))
+  NVIC_EnableIRQ(SPIIF_GET_QUEUE_NVIC(channel))
 
 /****************************************************************
  * Function declarations
  ***************************************************************/
 
 static BOOL SpiIf_ConvertSpiChannelToChannel(uint8_t* channel);
+static SpiIf_LengthType SpiIf_GetJobLength(const SpiIf_JobType* job);
+static BOOL SpiIf_FinishJob(uint8_t channel);
+static void SpiIf_SelectDevice(uint8_t channel, const SpiIf_JobType* job);
+static void SpiIf_Delay(uint16_t delay);
 
 static void SpiIf_TxIsr(uint8_t channel);
 static void SpiIf_RxIsr(uint8_t channel);
+static uint16_t SpiIf_GetTxFrame(const SpiIf_JobType* job, SpiIf_LengthType idx,
+  uint8_t frameBytes);
+static void SpiIf_PutRxFrame(SpiIf_JobType* job, uint16_t data, uint8_t frameBytes);
+static void SpiIf_UpdateRxThreshold(uint8_t channel, const SpiIf_JobType* job);
+static BOOL SpiIf_IsPackingAllowed(const SpiIf_JobType* job);
+
+static void SpiIf_DmaInit(uint8_t channel);
+static SpiIf_LengthType SpiIf_GetDmaSegment(const SpiIf_JobType* job,
+  uint8_t frameBytes, const SpiIf_DataType** txData, SpiIf_DataType** rxData);
+static void SpiIf_DmaStartTransfer(uint8_t channel);
 
 /****************************************************************
  * Global variables
@@ -83,6 +128,49 @@ static const SpiIf_PeriphClockCmd const SpiIf_clockCmds[] =
   RCC_APB1PeriphClockCmd
 };
 
+/* Fixed DMA request mapping of the STM32F0 (see reference manual) */
+static DMA_Channel_TypeDef* const SpiIf_dmaRxChannels[] =
+{
+  DMA1_Channel2,
+  DMA1_Channel4
+};
+
+static DMA_Channel_TypeDef* const SpiIf_dmaTxChannels[] =
+{
+  DMA1_Channel3,
+  DMA1_Channel5
+};
+
+static const IRQn_Type SpiIf_dmaNvics[] =
+{
+  DMA1_Channel2_3_IRQn,
+  DMA1_Channel4_5_IRQn
+};
+
+static const uint32_t SpiIf_dmaRxTcFlags[] =
+{
+  DMA1_IT_TC2,
+  DMA1_IT_TC4
+};
+
+static const uint32_t SpiIf_dmaFlags[] =
+{
+  DMA1_IT_GL2 | DMA1_IT_GL3,
+  DMA1_IT_GL4 | DMA1_IT_GL5
+};
+
+/* Device the SPI registers are currently programmed for */
+static const SpiIf_DeviceConfigType* SpiIf_currentDevices[] =
+{
+  NULL_PTR,
+  NULL_PTR
+};
+
+/* Transmit source outside of the transmit buffer and receive sink outside
+ *  of the receive buffer, used without memory increment (8 or 16 bit) */
+static const uint16_t SpiIf_dmaDummy = 0u;
+static uint16_t SpiIf_dmaSink = 0u;
+
 /****************************************************************
  * User functions
  ***************************************************************/
@@ -115,11 +203,23 @@ void SpiIf_Init(SpiIf_ConfigType* config)
       /* Initialize SPI */
       SPI_Init(SPIIF_GET_REGISTER(channel), channelConfig->initSettings);
 
-      /* Initialize receive interrupt */
-      SPI_I2S_ITConfig(SPIIF_GET_REGISTER(channel), SPI_I2S_IT_RXNE, ENABLE);
+      /* Device settings are applied with the first job */
+      SPIIF_GET_CURRENT_DEVICE(channel) = NULL_PTR;
+
+      if (channelConfig->dmaUsed)
+      {
+        /* Initialize DMA channels and the transfer complete interrupt */
+        SpiIf_DmaInit(channel);
+        NVIC_EnableIRQ(SPIIF_GET_DMA_NVIC(channel));
+      }
+      else
+      {
+        /* Initialize receive interrupt */
+        SPI_I2S_ITConfig(SPIIF_GET_REGISTER(channel), SPI_I2S_IT_RXNE, ENABLE);
 
-      /* Enable interrupts */
-      NVIC_EnableIRQ(SPIIF_GET_NVIC(channel));
+        /* Enable interrupts */
+        NVIC_EnableIRQ(SPIIF_GET_NVIC(channel));
+      }
 
       /* Enable SPI peripheral */
       SPI_Cmd(SPIIF_GET_REGISTER(channel), ENABLE);
@@ -133,24 +233,40 @@ void SpiIf_EnqueueJob(uint8_t channel, SpiIf_JobType* job)
   BOOL isEmpty;
   SpiIf_ChannelConfigType* channelConfig;
   SpiIf_QueueType* jobQueue;
+  SpiIf_JobType* link;
+  SpiIf_LengthType idx;
+  SpiIf_LengthType prevIdx;
+  SpiIf_LengthType count;
 
   /* Initialize local variables */
   isEmpty = FALSE;
   channelConfig = NULL_PTR;
   jobQueue = NULL_PTR;
+  link = NULL_PTR;
+  idx = 0u;
+  prevIdx = 0u;
+  count = 0u;
 
   /* Check user configuration and parameters */
   if ((SpiIf_userCfg != NULL_PTR) && (channel < SpiIf_userCfg->numberOfChannels)
-      && (job != NULL_PTR))
+      && (job != NULL_PTR) && (job->device != NULL_PTR))
   {
     /* Get configurations */
     channelConfig = &SpiIf_userCfg->channelConfigs[channel];
     jobQueue = channelConfig->jobQueue;
 
-    /* Update job variables for correct handling */
-    job->currentTxIdx = 0u;
-    job->currentRxIdx = 0u;
-    job->state = SpiIf_JobReverted;
+    /* Update job variables of all linked jobs for correct handling */
+    for (link = job; link != NULL_PTR; link = link->next)
+    {
+      /* The DMA does not transfer half words from odd addresses */
+      assert_param(!channelConfig->dmaUsed || (SPIIF_GET_FRAME_BYTES(link) == 1u)
+        || ((((uint32_t) link->transmittBuffer | (uint32_t) link->receiveBuffer)
+          & 1u) == 0u));
+
+      link->currentTxIdx = 0u;
+      link->currentRxIdx = 0u;
+      link->state = SpiIf_JobReverted;
+    }
 
     /* Enter critical section (stop SPI interrupts) */
     SPIIF_ENTER_CS(channel);
@@ -160,23 +276,64 @@ void SpiIf_EnqueueJob(uint8_t channel, SpiIf_JobType* job)
 
     if (jobQueue->space > 0u)
     {
-      /* Queue new job and update queue variables */
-      jobQueue->jobs[jobQueue->wrIdx] = job;
+      /* Queue new job behind all jobs with the same or a higher priority.
+       *  The head of the queue may be in progress and is never displaced */
+      idx = jobQueue->wrIdx;
+      count = (SpiIf_LengthType) (jobQueue->size - jobQueue->space);
+      while (count > 1u)
+      {
+        prevIdx = (SpiIf_LengthType) ((idx + jobQueue->size - 1u) % jobQueue->size);
+        if (jobQueue->jobs[prevIdx]->priority >= job->priority)
+          break;
+
+        jobQueue->jobs[idx] = jobQueue->jobs[prevIdx];
+        idx = prevIdx;
+        count--;
+      }
+      jobQueue->jobs[idx] = job;
+
+      /* Update queue variables */
       jobQueue->wrIdx = (SpiIf_LengthType) ((jobQueue->wrIdx + 1u)
         % jobQueue->size);
       jobQueue->space--;
 
-      /* Update state to job queued */
-      job->state = SpiIf_JobQueued;
+      /* Update state of all linked jobs to job queued */
+      for (link = job; link != NULL_PTR; link = link->next)
+        link->state = SpiIf_JobQueued;
     }
 
     /* Leave critical section (restart SPI interrupts) */
     SPIIF_LEAVE_CS(channel);
 
-    /* If queue was empty, start ISR handling */
+    /* If queue was empty, start DMA or ISR handling */
     if (isEmpty)
-      SPI_I2S_ITConfig(SPIIF_GET_REGISTER(channel), SPI_I2S_IT_TXE, ENABLE);
+    {
+      if (channelConfig->dmaUsed)
+        SpiIf_DmaStartTransfer(channel);
+      else
+        SPI_I2S_ITConfig(SPIIF_GET_REGISTER(channel), SPI_I2S_IT_TXE, ENABLE);
+    }
+  }
+}
+
+BOOL SpiIf_IsJobProcessed(const SpiIf_JobType* job)
+{
+  /* Local variables */
+  BOOL ret;
+
+  /* Initialize local variables */
+  ret = FALSE;
+
+  /* Linked jobs are processed in order, so the last one decides */
+  if (job != NULL_PTR)
+  {
+    while (job->next != NULL_PTR)
+      job = job->next;
+
+    ret = job->state == SpiIf_JobProcessed;
   }
+
+  return ret;
 }
 
 /****************************************************************
@@ -201,6 +358,57 @@ void SpiIf_Isr(uint8_t channel)
   }
 }
 
+void SpiIf_DmaIsr(uint8_t channel)
+{
+  /* Local variables */
+  SpiIf_QueueType* jobQueue;
+  SpiIf_JobType* currentJob;
+  SpiIf_LengthType length;
+  const SpiIf_DataType* txData;
+  SpiIf_DataType* rxData;
+
+  /* Initialize local variables */
+  jobQueue = NULL_PTR;
+  currentJob = NULL_PTR;
+  length = 0u;
+  txData = NULL_PTR;
+  rxData = NULL_PTR;
+
+  /* Check user configuration and if the given SPI channel exists. The DMA
+   *  interrupt is shared, so only react on the own receive channel */
+  if ((SpiIf_userCfg != NULL_PTR) && SpiIf_ConvertSpiChannelToChannel(&channel)
+      && SpiIf_userCfg->channelConfigs[channel].dmaUsed
+      && (DMA_GetITStatus(SPIIF_GET_DMA_RX_TC(channel)) == SET))
+  {
+    DMA_ClearITPendingBit(SPIIF_GET_DMA_FLAGS(channel));
+
+    /* Receive channel completes last, so both channels are idle now */
+    SPIIF_GET_DMA_RX(channel)->CCR &= ~DMA_CCR_EN;
+    SPIIF_GET_DMA_TX(channel)->CCR &= ~DMA_CCR_EN;
+
+    jobQueue = SpiIf_userCfg->channelConfigs[channel].jobQueue;
+    currentJob = jobQueue->jobs[jobQueue->rdIdx];
+
+    /* Recalculate the finished segment and update job variables */
+    length = SpiIf_GetDmaSegment(currentJob, SPIIF_GET_FRAME_BYTES(currentJob),
+      &txData, &rxData);
+    currentJob->currentTxIdx = (SpiIf_LengthType) (currentJob->currentTxIdx + length);
+    currentJob->currentRxIdx = (SpiIf_LengthType) (currentJob->currentRxIdx + length);
+
+    /* Job manipulation callback, called once per segment. Further
+     *  processing depends on the (maybe changed) job variables only */
+    if (currentJob->rxNotifier != NULL_PTR)
+      (void) currentJob->rxNotifier(currentJob);
+
+    /* Segments are single items if the device needs a delay */
+    if (currentJob->currentRxIdx < SpiIf_GetJobLength(currentJob))
+      SpiIf_Delay(currentJob->device->interItemDelay);
+
+    /* Continue job, or finish it and start the next one */
+    SpiIf_DmaStartTransfer(channel);
+  }
+}
+
 /****************************************************************
  * Static functions
  ***************************************************************/
@@ -229,44 +437,202 @@ static BOOL SpiIf_ConvertSpiChannelToChannel(uint8_t* channel)
   return ret;
 }
 
-static void SpiIf_TxIsr(uint8_t channel)
+static SpiIf_LengthType SpiIf_GetJobLength(const SpiIf_JobType* job)
+{
+  /* Local variables */
+  SpiIf_LengthType jobLength;
+
+  /* Initialize local variables */
+  jobLength = (SpiIf_LengthType) (job->receiveBegin + job->receiveLength);
+
+  /* A job lasts until the last item was transmitted and received */
+  if (jobLength < job->transmittLength)
+    jobLength = job->transmittLength;
+
+  return jobLength;
+}
+
+static BOOL SpiIf_FinishJob(uint8_t channel)
 {
   /* Local variables */
-  SpiIf_DataType data;
   SpiIf_QueueType* jobQueue;
   SpiIf_JobType* currentJob;
-  SpiIf_LengthType jobLength;
 
   /* Initialize local variables */
-  data = 0u;
   jobQueue = SpiIf_userCfg->channelConfigs[channel].jobQueue;
   currentJob = jobQueue->jobs[jobQueue->rdIdx];
-  jobLength = (SpiIf_LengthType)(currentJob->receiveLength + currentJob->receiveLength);
-  if (jobLength < currentJob->transmittLength)
-    jobLength = currentJob->transmittLength;
+
+  /* Release CS, unless the transaction continues under the same CS */
+  if ((currentJob->next == NULL_PTR) || !currentJob->keepCs)
+    GpioIf_HandleClr(currentJob->device->cs);
 
   /* Update job state */
-  currentJob->state = SpiIf_JobProcessing;
-  /* Set CS in any case */
-  GpioIf_SetBit(currentJob->cs);
+  currentJob->state = SpiIf_JobProcessed;
 
-  /* Check if all bytes were send */
-  if (currentJob->currentTxIdx < jobLength)
+  if (currentJob->next != NULL_PTR)
   {
-    /* If not, check if there are some input bytes */
-    if (currentJob->currentTxIdx < currentJob->transmittLength)
-      /* If yes, update data field */
-      data = currentJob->transmittBuffer[currentJob->currentTxIdx];
-
-    /* Send input data or dummy data to read values */
-    SPI_SendData8(SPIIF_GET_REGISTER(channel), data);
-    /* Update job variables */
-    currentJob->currentTxIdx++;
+    /* Continue with the linked job, which takes over the queue entry */
+    jobQueue->jobs[jobQueue->rdIdx] = currentJob->next;
   }
   else
   {
-    /* Disable transmit ISR */
-    SPI_I2S_ITConfig(SPIIF_GET_REGISTER(channel), SPI_I2S_IT_TXE, DISABLE);
+    /* Switch to next job */
+    jobQueue->rdIdx = (SpiIf_LengthType) ((jobQueue->rdIdx + 1u) % jobQueue->size);
+    jobQueue->space++;
+  }
+
+  /* Notify completion once, the queue entry is already released */
+  if (currentJob->completion != NULL_PTR)
+    currentJob->completion(currentJob);
+
+  /* Return TRUE, if there are further (linked) jobs */
+  return jobQueue->space < jobQueue->size;
+}
+
+static void SpiIf_SelectDevice(uint8_t channel, const SpiIf_JobType* job)
+{
+  /* Local variables */
+  SpiIf_InitSettingsType initSettings;
+  const SpiIf_DeviceConfigType* current;
+  const SpiIf_DeviceConfigType* device;
+  SPI_TypeDef* spi;
+  uint32_t dmaDataSize;
+
+  /* Initialize local variables */
+  initSettings = *SpiIf_userCfg->channelConfigs[channel].initSettings;
+  current = SPIIF_GET_CURRENT_DEVICE(channel);
+  device = job->device;
+  spi = SPIIF_GET_REGISTER(channel);
+  dmaDataSize = (SPIIF_GET_FRAME_BYTES(job) > 1u) ?
+    (DMA_PeripheralDataSize_HalfWord | DMA_MemoryDataSize_HalfWord)
+    : (DMA_PeripheralDataSize_Byte | DMA_MemoryDataSize_Byte);
+
+  /* Reprogram the bus only if the settings differ from the last job */
+  if ((current == NULL_PTR)
+    || (current->cpol != device->cpol)
+    || (current->cpha != device->cpha)
+    || (current->baudRatePrescaler != device->baudRatePrescaler)
+    || (current->dataSize != device->dataSize)
+    || (current->firstBit != device->firstBit))
+  {
+    initSettings.SPI_CPOL = device->cpol;
+    initSettings.SPI_CPHA = device->cpha;
+    initSettings.SPI_BaudRatePrescaler = device->baudRatePrescaler;
+    initSettings.SPI_DataSize = device->dataSize;
+    initSettings.SPI_FirstBit = device->firstBit;
+
+    /* Clock settings may only be changed with disabled SPI */
+    SPI_Cmd(spi, DISABLE);
+    SPI_Init(spi, &initSettings);
+
+    /* Signal every received item, otherwise the last 8 bit item of an
+     *  odd length job is never reported. The interrupt path adapts the
+     *  threshold per job */
+    SPI_RxFIFOThresholdConfig(spi, (SPIIF_GET_FRAME_BYTES(job) > 1u) ?
+      SPI_RxFIFOThreshold_HF : SPI_RxFIFOThreshold_QF);
+
+    /* Transfer width of the (disabled) DMA channels */
+    if (SpiIf_userCfg->channelConfigs[channel].dmaUsed)
+    {
+      SPIIF_GET_DMA_RX(channel)->CCR = (SPIIF_GET_DMA_RX(channel)->CCR
+        & ~(DMA_CCR_PSIZE | DMA_CCR_MSIZE)) | dmaDataSize;
+      SPIIF_GET_DMA_TX(channel)->CCR = (SPIIF_GET_DMA_TX(channel)->CCR
+        & ~(DMA_CCR_PSIZE | DMA_CCR_MSIZE)) | dmaDataSize;
+    }
+
+    SPI_Cmd(spi, ENABLE);
+  }
+
+  SPIIF_GET_CURRENT_DEVICE(channel) = device;
+}
+
+static void SpiIf_Delay(uint16_t delay)
+{
+  /* Local variables */
+  volatile uint32_t loops;
+
+  /* Initialize local variables */
+  loops = (uint32_t) delay * SpiIf_userCfg->delayLoopsPerUs;
+
+  /* Busy waiting, delays are in the range of a few microseconds */
+  while (loops > 0u)
+    loops--;
+}
+
+static void SpiIf_TxIsr(uint8_t channel)
+{
+  /* Local variables */
+  uint16_t data;
+  SPI_TypeDef* spi;
+  SpiIf_QueueType* jobQueue;
+  SpiIf_JobType* currentJob;
+  SpiIf_LengthType jobLength;
+  SpiIf_LengthType inFlightLimit;
+  uint8_t frameBytes;
+  BOOL packing;
+
+  /* Initialize local variables */
+  data = 0u;
+  spi = SPIIF_GET_REGISTER(channel);
+  jobQueue = SpiIf_userCfg->channelConfigs[channel].jobQueue;
+  currentJob = jobQueue->jobs[jobQueue->rdIdx];
+  jobLength = SpiIf_GetJobLength(currentJob);
+  frameBytes = SPIIF_GET_FRAME_BYTES(currentJob);
+  /* Jobs with notifier or inter item delay are handled item by item, so
+   *  that a manipulation takes effect with the next item; all others fill
+   *  the FIFO and pack two 8 bit items into one 16 bit access */
+  packing = SpiIf_IsPackingAllowed(currentJob);
+  inFlightLimit = ((currentJob->rxNotifier == NULL_PTR)
+    && (currentJob->device->interItemDelay == 0u)) ?
+      (SpiIf_LengthType) (SPIIF_FIFO_SIZE / frameBytes) : 1u;
+
+  /* Update job state, apply device settings, set CS and prepare reception
+   *  at the beginning of the job */
+  if (currentJob->state != SpiIf_JobProcessing)
+  {
+    currentJob->state = SpiIf_JobProcessing;
+    SpiIf_SelectDevice(channel, currentJob);
+    GpioIf_HandleSet(currentJob->device->cs);
+    SpiIf_UpdateRxThreshold(channel, currentJob);
+  }
+
+  /* Fill transmit FIFO with input data or dummy data to read values */
+  while ((currentJob->currentTxIdx < jobLength)
+    && ((SpiIf_LengthType) (currentJob->currentTxIdx - currentJob->currentRxIdx)
+      < inFlightLimit)
+    && (SPI_I2S_GetFlagStatus(spi, SPI_I2S_FLAG_TXE) == SET))
+  {
+    data = SpiIf_GetTxFrame(currentJob, currentJob->currentTxIdx, frameBytes);
+
+    if (frameBytes > 1u)
+    {
+      SPI_I2S_SendData16(spi, data);
+      currentJob->currentTxIdx++;
+    }
+    else if (packing && ((SpiIf_LengthType) (jobLength - currentJob->currentTxIdx) >= 2u)
+      && ((SpiIf_LengthType) (currentJob->currentTxIdx - currentJob->currentRxIdx + 2u)
+        <= inFlightLimit))
+    {
+      /* Two items at once, the first one is shifted out first */
+      data |= (uint16_t) (SpiIf_GetTxFrame(currentJob,
+        (SpiIf_LengthType) (currentJob->currentTxIdx + 1u), frameBytes) << 8);
+      SPI_I2S_SendData16(spi, data);
+      currentJob->currentTxIdx = (SpiIf_LengthType) (currentJob->currentTxIdx + 2u);
+    }
+    else
+    {
+      SPI_SendData8(spi, (uint8_t) data);
+      currentJob->currentTxIdx++;
+    }
+  }
+
+  /* Disable transmit ISR if all items were sent or the FIFO limit was
+   *  reached; the receive ISR enables it again */
+  if ((currentJob->currentTxIdx >= jobLength)
+    || ((SpiIf_LengthType) (currentJob->currentTxIdx - currentJob->currentRxIdx)
+      >= inFlightLimit))
+  {
+    SPI_I2S_ITConfig(spi, SPI_I2S_IT_TXE, DISABLE);
   }
 }
 
@@ -274,49 +640,291 @@ static void SpiIf_RxIsr(uint8_t channel)
 {
   /* Local variables */
   BOOL enableTransmission;
-  SpiIf_DataType data;
+  uint16_t data;
+  SPI_TypeDef* spi;
   SpiIf_QueueType* jobQueue;
   SpiIf_JobType* currentJob;
   SpiIf_LengthType jobLength;
-  SpiIf_LengthType idx;
+  uint16_t fifoLevel;
+  uint8_t frameBytes;
+  BOOL packing;
 
   /* Initialize local variables */
   enableTransmission = FALSE;
   data = 0u;
+  spi = SPIIF_GET_REGISTER(channel);
   jobQueue = SpiIf_userCfg->channelConfigs[channel].jobQueue;
   currentJob = jobQueue->jobs[jobQueue->rdIdx];
-  idx = (SpiIf_LengthType) (currentJob->currentRxIdx - currentJob->receiveBegin);
-  jobLength = (SpiIf_LengthType)(currentJob->receiveLength + currentJob->receiveLength);
-  if (jobLength < currentJob->transmittLength)
-    jobLength = currentJob->transmittLength;
-
-  /* Get data from SPI */
-  data = SPI_ReceiveData8(SPIIF_GET_REGISTER(channel));
-
-  /* Store data to destination buffer */
-  if (idx < currentJob->receiveLength)
-    currentJob->receiveBuffer[idx] = data;
+  jobLength = SpiIf_GetJobLength(currentJob);
+  fifoLevel = SPI_GetReceptionFIFOStatus(spi);
+  frameBytes = SPIIF_GET_FRAME_BYTES(currentJob);
+  packing = SpiIf_IsPackingAllowed(currentJob);
+
+  /* Drain receive FIFO */
+  while ((fifoLevel != SPI_ReceptionFIFOStatus_Empty)
+    && (currentJob->currentRxIdx < jobLength))
+  {
+    if (frameBytes > 1u)
+    {
+      SpiIf_PutRxFrame(currentJob, SPI_I2S_ReceiveData16(spi), frameBytes);
+    }
+    else if (packing && (fifoLevel >= SPI_ReceptionFIFOStatus_HalfFull))
+    {
+      /* Two items at once, the first one is in the low byte */
+      data = SPI_I2S_ReceiveData16(spi);
+      SpiIf_PutRxFrame(currentJob, (uint16_t) (data & 0xFFu), frameBytes);
+      SpiIf_PutRxFrame(currentJob, (uint16_t) (data >> 8), frameBytes);
+    }
+    else
+    {
+      SpiIf_PutRxFrame(currentJob, SPI_ReceiveData8(spi), frameBytes);
+    }
 
-  /* Update job variables */
-  currentJob->currentRxIdx++;
+    /* Call job manipulation callback and check if the job was
+     *  manipulated through it */
+    if ((currentJob->rxNotifier != NULL_PTR) && currentJob->rxNotifier(currentJob))
+      enableTransmission = TRUE;
 
-  /* Call job manipulation callback and check if the job was
-   *  manipulated through it */
-  enableTransmission = ((currentJob->rxNotifier != NULL_PTR)
-    && currentJob->rxNotifier(currentJob));
+    jobLength = SpiIf_GetJobLength(currentJob);
+    fifoLevel = SPI_GetReceptionFIFOStatus(spi);
+  }
 
   /* Check if job was finished */
   if (currentJob->currentRxIdx >= jobLength)
   {
     /* If yes, update job state and switch to next job */
-    GpioIf_ClrBit(currentJob->cs);
-    currentJob->state = SpiIf_JobProcessed;
-    jobQueue->rdIdx = (SpiIf_LengthType) ((jobQueue->rdIdx + 1u) % jobQueue->size);
-    jobQueue->space++;
-    enableTransmission |= jobQueue->space < jobQueue->size;
+    enableTransmission |= SpiIf_FinishJob(channel);
+  }
+  else
+  {
+    /* Otherwise continue transmission (after the device delay) and adapt
+     *  the FIFO threshold for the remaining items */
+    if (currentJob->currentTxIdx < jobLength)
+    {
+      SpiIf_Delay(currentJob->device->interItemDelay);
+      enableTransmission = TRUE;
+    }
+    SpiIf_UpdateRxThreshold(channel, currentJob);
   }
 
   /* Enable transmission, if the job was manipulated or a new job was scheduled */
   if (enableTransmission)
-    SPI_I2S_ITConfig(SPIIF_GET_REGISTER(channel), SPI_I2S_IT_TXE, ENABLE);
+    SPI_I2S_ITConfig(spi, SPI_I2S_IT_TXE, ENABLE);
+}
+
+static uint16_t SpiIf_GetTxFrame(const SpiIf_JobType* job, SpiIf_LengthType idx,
+  uint8_t frameBytes)
+{
+  /* Local variables */
+  uint16_t data;
+  uint32_t offset;
+
+  /* Initialize local variables */
+  data = 0u;
+  offset = (uint32_t) idx * frameBytes;
+
+  /* Input data or dummy data behind the transmit buffer; bytewise access
+   *  as the buffer needs not to be aligned */
+  if (idx < job->transmittLength)
+  {
+    data = job->transmittBuffer[offset];
+    if (frameBytes > 1u)
+      data |= (uint16_t) (job->transmittBuffer[offset + 1u] << 8);
+  }
+
+  return data;
+}
+
+static void SpiIf_PutRxFrame(SpiIf_JobType* job, uint16_t data, uint8_t frameBytes)
+{
+  /* Local variables */
+  SpiIf_LengthType idx;
+  uint32_t offset;
+
+  /* Initialize local variables */
+  idx = (SpiIf_LengthType) (job->currentRxIdx - job->receiveBegin);
+  offset = (uint32_t) idx * frameBytes;
+
+  /* Store data to destination buffer, if inside the receive window */
+  if (idx < job->receiveLength)
+  {
+    job->receiveBuffer[offset] = (SpiIf_DataType) data;
+    if (frameBytes > 1u)
+      job->receiveBuffer[offset + 1u] = (SpiIf_DataType) (data >> 8);
+  }
+
+  /* Update job variables */
+  job->currentRxIdx++;
+}
+
+static void SpiIf_UpdateRxThreshold(uint8_t channel, const SpiIf_JobType* job)
+{
+  /* Wait for 16 bit as long as packed items are expected. The last
+   *  (or a single) 8 bit item needs the quarter threshold */
+  if ((SPIIF_GET_FRAME_BYTES(job) > 1u)
+    || (SpiIf_IsPackingAllowed(job)
+      && ((SpiIf_LengthType) (SpiIf_GetJobLength(job) - job->currentRxIdx) >= 2u)))
+  {
+    SPI_RxFIFOThresholdConfig(SPIIF_GET_REGISTER(channel), SPI_RxFIFOThreshold_HF);
+  }
+  else
+  {
+    SPI_RxFIFOThresholdConfig(SPIIF_GET_REGISTER(channel), SPI_RxFIFOThreshold_QF);
+  }
+}
+
+static BOOL SpiIf_IsPackingAllowed(const SpiIf_JobType* job)
+{
+  /* Two 8 bit items per access, if they need not to be handled one by one */
+  return (job->rxNotifier == NULL_PTR) && (job->device->interItemDelay == 0u)
+    && (SPIIF_GET_FRAME_BYTES(job) == 1u);
+}
+
+static void SpiIf_DmaInit(uint8_t channel)
+{
+  /* Local variables */
+  DMA_InitTypeDef dmaInit;
+
+  /* Initialize local variables (transfer width is set per device) */
+  dmaInit.DMA_PeripheralBaseAddr = (uint32_t) &SPIIF_GET_REGISTER(channel)->DR;
+  dmaInit.DMA_MemoryBaseAddr = (uint32_t) &SpiIf_dmaSink;
+  dmaInit.DMA_DIR = DMA_DIR_PeripheralSRC;
+  dmaInit.DMA_BufferSize = 1u;
+  dmaInit.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+  dmaInit.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  dmaInit.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+  dmaInit.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+  dmaInit.DMA_Mode = DMA_Mode_Normal;
+  dmaInit.DMA_Priority = DMA_Priority_VeryHigh;
+  dmaInit.DMA_M2M = DMA_M2M_Disable;
+
+  /* Enable DMA clock */
+  RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+
+  /* Receive channel, served before transmit to avoid overruns */
+  DMA_Init(SPIIF_GET_DMA_RX(channel), &dmaInit);
+  DMA_ITConfig(SPIIF_GET_DMA_RX(channel), DMA_IT_TC, ENABLE);
+
+  /* Transmit channel, without interrupt */
+  dmaInit.DMA_MemoryBaseAddr = (uint32_t) &SpiIf_dmaDummy;
+  dmaInit.DMA_DIR = DMA_DIR_PeripheralDST;
+  dmaInit.DMA_Priority = DMA_Priority_High;
+  DMA_Init(SPIIF_GET_DMA_TX(channel), &dmaInit);
+
+  /* Let the SPI request both channels */
+  SPI_I2S_DMACmd(SPIIF_GET_REGISTER(channel),
+    SPI_I2S_DMAReq_Rx | SPI_I2S_DMAReq_Tx, ENABLE);
+}
+
+static SpiIf_LengthType SpiIf_GetDmaSegment(const SpiIf_JobType* job,
+  uint8_t frameBytes, const SpiIf_DataType** txData, SpiIf_DataType** rxData)
+{
+  /* Local variables */
+  SpiIf_LengthType idx;
+  SpiIf_LengthType end;
+  SpiIf_LengthType rxEnd;
+
+  /* Initialize local variables */
+  idx = job->currentTxIdx;
+  end = SpiIf_GetJobLength(job);
+  rxEnd = (SpiIf_LengthType) (job->receiveBegin + job->receiveLength);
+  *txData = NULL_PTR;
+  *rxData = NULL_PTR;
+
+  /* A segment ends at the next boundary of the transmit buffer or the
+   *  receive window, so each segment has a fixed source and destination */
+  if (idx < job->transmittLength)
+  {
+    *txData = &job->transmittBuffer[idx * frameBytes];
+    if (job->transmittLength < end)
+      end = job->transmittLength;
+  }
+
+  if ((idx >= job->receiveBegin) && (idx < rxEnd))
+  {
+    *rxData = &job->receiveBuffer[(idx - job->receiveBegin) * frameBytes];
+    if (rxEnd < end)
+      end = rxEnd;
+  }
+  else if ((idx < job->receiveBegin) && (job->receiveBegin < end))
+  {
+    end = job->receiveBegin;
+  }
+
+  /* Single items, if the device needs a delay between them */
+  if ((job->device->interItemDelay > 0u) && (idx < end))
+    end = (SpiIf_LengthType) (idx + 1u);
+
+  return (idx < end) ? (SpiIf_LengthType) (end - idx) : 0u;
+}
+
+static void SpiIf_DmaStartTransfer(uint8_t channel)
+{
+  /* Local variables */
+  SpiIf_QueueType* jobQueue;
+  SpiIf_JobType* currentJob;
+  SpiIf_LengthType length;
+  const SpiIf_DataType* txData;
+  SpiIf_DataType* rxData;
+  DMA_Channel_TypeDef* rxChannel;
+  DMA_Channel_TypeDef* txChannel;
+
+  /* Initialize local variables */
+  jobQueue = SpiIf_userCfg->channelConfigs[channel].jobQueue;
+  currentJob = NULL_PTR;
+  length = 0u;
+  txData = NULL_PTR;
+  rxData = NULL_PTR;
+  rxChannel = SPIIF_GET_DMA_RX(channel);
+  txChannel = SPIIF_GET_DMA_TX(channel);
+
+  /* Start the next segment; finished (or empty) jobs are completed until
+   *  a segment was started or the queue is empty. A completion callback may
+   *  already have started a segment by enqueuing into the empty queue */
+  while (((rxChannel->CCR & DMA_CCR_EN) == 0u)
+    && (jobQueue->space < jobQueue->size))
+  {
+    currentJob = jobQueue->jobs[jobQueue->rdIdx];
+
+    /* Update job state, apply device settings and set CS at the
+     *  beginning of the job */
+    if (currentJob->state != SpiIf_JobProcessing)
+    {
+      currentJob->state = SpiIf_JobProcessing;
+      SpiIf_SelectDevice(channel, currentJob);
+      GpioIf_HandleSet(currentJob->device->cs);
+    }
+
+    length = SpiIf_GetDmaSegment(currentJob, SPIIF_GET_FRAME_BYTES(currentJob),
+      &txData, &rxData);
+
+    if (length > 0u)
+    {
+      /* Receive into buffer or sink */
+      rxChannel->CMAR = (rxData != NULL_PTR) ? (uint32_t) rxData
+        : (uint32_t) &SpiIf_dmaSink;
+      rxChannel->CNDTR = length;
+      if (rxData != NULL_PTR)
+        rxChannel->CCR |= DMA_CCR_MINC;
+      else
+        rxChannel->CCR &= ~DMA_CCR_MINC;
+
+      /* Transmit from buffer or dummy */
+      txChannel->CMAR = (txData != NULL_PTR) ? (uint32_t) txData
+        : (uint32_t) &SpiIf_dmaDummy;
+      txChannel->CNDTR = length;
+      if (txData != NULL_PTR)
+        txChannel->CCR |= DMA_CCR_MINC;
+      else
+        txChannel->CCR &= ~DMA_CCR_MINC;
+
+      /* Receive channel first, transmit starts the transfer */
+      rxChannel->CCR |= DMA_CCR_EN;
+      txChannel->CCR |= DMA_CCR_EN;
+    }
+    else
+    {
+      (void) SpiIf_FinishJob(channel);
+    }
+  }
 }
@@ -28,7 +28,7 @@
 struct SpiIf_JobStructType;
 
 typedef uint8_t SpiIf_DataType;
-typedef uint8_t SpiIf_LengthType;
+typedef uint16_t SpiIf_LengthType;
 typedef SPI_InitTypeDef SpiIf_InitSettingsType;
 typedef uint32_t SpiIf_ClockDomainType;
 typedef IRQn_Type SpiIf_NvicIrqType;
@@ -41,6 +41,32 @@ typedef IRQn_Type SpiIf_NvicIrqType;
  */
 typedef BOOL (*SpiIf_JobNotifier)(struct SpiIf_JobStructType* job);
 
+/**
+ * Function pointer for job completion. Called once, after the job was
+ *  processed and removed from the queue, so it may enqueue further jobs.
+ * @param job The processed job.
+ */
+typedef void (*SpiIf_JobCompletion)(struct SpiIf_JobStructType* job);
+
+/**
+ * Device descriptor. Holds the bus settings of one device; the bus is
+ *  reprogrammed only if consecutive jobs use different settings.
+ */
+typedef struct
+{
+  const GpioIf_HandleType cs;
+  const uint16_t cpol;
+  const uint16_t cpha;
+  const uint16_t baudRatePrescaler;
+  const uint16_t dataSize;
+  const uint16_t firstBit;
+  /**
+   * Delay between two items in microseconds (busy waiting in the interrupt),
+   *  0 for back to back transfers.
+   */
+  const uint16_t interItemDelay;
+} SpiIf_DeviceConfigType;
+
 typedef enum
 {
   SpiIf_JobUnprocessed,
@@ -50,9 +76,20 @@ typedef enum
   SpiIf_JobProcessed
 } SpiIf_JobStateType;
 
+/**
+ * SPI job. Lengths and indices count items of the configured data size;
+ *  items wider than 8 bit occupy two bytes (little endian) in the buffers.
+ *  On channels with DMA these items are transferred as half words, so
+ *  their buffers have to be 2 byte aligned.
+ */
 struct SpiIf_JobStructType
 {
-  GpioIf_ChannelType cs;
+  const SpiIf_DeviceConfigType* device;
+  /**
+   * Queue priority, higher values overtake lower ones. A job in progress
+   *  is never interrupted.
+   */
+  uint8_t priority;
   const SpiIf_DataType* transmittBuffer;
   SpiIf_LengthType transmittLength;
   SpiIf_LengthType currentTxIdx;
@@ -61,10 +98,27 @@ struct SpiIf_JobStructType
   SpiIf_LengthType receiveBegin;
   SpiIf_LengthType currentRxIdx;
   /**
-   * Receive notification callback. Will be called each time a item was received.
+   * Optional receive notification callback, NULL_PTR if not needed. Will be
+   *  called each time an item was received (once per segment with DMA) and
+   *  forces item by item processing.
    * Be carefully, it's interrupt driven!
    */
   SpiIf_JobNotifier rxNotifier;
+  /**
+   * Optional completion callback, NULL_PTR if not needed.
+   * Be carefully, it's interrupt driven!
+   */
+  SpiIf_JobCompletion completion;
+  /**
+   * Linked job, executed directly after this one within the same queue
+   *  entry (e.g. command followed by data). NULL_PTR ends the transaction.
+   */
+  struct SpiIf_JobStructType* next;
+  /**
+   * If TRUE, CS stays asserted for the linked job, which has to use the
+   *  same device. Ignored for the last job of a transaction.
+   */
+  BOOL keepCs;
   SpiIf_JobStateType state;
 };
 typedef struct SpiIf_JobStructType SpiIf_JobType;
@@ -83,12 +137,21 @@ typedef struct
   SpiIf_QueueType* const jobQueue;
   const uint8_t spiChannelNumber;
   const SpiIf_InitSettingsType* initSettings;
+  /**
+   * If TRUE, jobs are transferred by the DMA controller (one interrupt per
+   *  contiguous transmit/receive phase); otherwise one interrupt per item.
+   */
+  const BOOL dmaUsed;
 } SpiIf_ChannelConfigType;
 
 typedef struct
 {
   const uint8_t numberOfChannels;
   SpiIf_ChannelConfigType* channelConfigs;
+  /**
+   * Busy wait loops per microsecond, used for inter item delays.
+   */
+  const uint16_t delayLoopsPerUs;
 } SpiIf_ConfigType;
 
 /****************************************************************
@@ -100,6 +163,7 @@ typedef struct
  ***************************************************************/
 
 extern SpiIf_ConfigType SpiIf_config;
+extern const SpiIf_DeviceConfigType SpiIf_devices[];
 
 /****************************************************************
  * User functions
@@ -108,10 +172,19 @@ extern SpiIf_ConfigType SpiIf_config;
 void SpiIf_Init(SpiIf_ConfigType* config);
 void SpiIf_EnqueueJob(uint8_t channel, SpiIf_JobType* job);
 
+/**
+ * Checks if a job and all jobs linked to it were processed. Can be polled
+ *  by main loop state machines instead of a completion callback.
+ * @param job The (first) job of the transaction.
+ * @return TRUE if the transaction was processed; otherwise FALSE.
+ */
+BOOL SpiIf_IsJobProcessed(const SpiIf_JobType* job);
+
 /****************************************************************
  * Internal functions/callbacks
  ***************************************************************/
 
 void SpiIf_Isr(uint8_t channel);
+void SpiIf_DmaIsr(uint8_t channel);
 
 #endif
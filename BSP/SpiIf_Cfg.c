@@ -58,14 +58,29 @@ static SpiIf_ChannelConfigType SpiIf_channels[SPIIF_NUMBER_OF_CHANNELS] =
   {
     &SpiIf_queue0,
     SPIIF_SPI_CHANNEL_NUMBER0,
-    &SpiIf_initSettings0
+    &SpiIf_initSettings0,
+    SPIIF_DMA_USED0
   }
 };
 
 SpiIf_ConfigType SpiIf_config =
 {
   SPIIF_NUMBER_OF_CHANNELS,
-  SpiIf_channels
+  SpiIf_channels,
+  SPIIF_DELAY_LOOPS_PER_US
+};
+
+const SpiIf_DeviceConfigType SpiIf_devices[SPIIF_NUMBER_OF_DEVICES] =
+{
+  {
+    GPIOIF_HANDLE(SPIIF_DEVICE_CS0),
+    SPIIF_DEVICE_CPOL0,
+    SPIIF_DEVICE_CPHA0,
+    SPIIF_DEVICE_BAUDRATE_PRESCALER0,
+    SPIIF_DEVICE_DATA_SIZE0,
+    SPIIF_DEVICE_FIRST_BIT0,
+    SPIIF_DEVICE_INTER_ITEM_DELAY0
+  }
 };
 
 /****************************************************************
@@ -20,13 +20,33 @@
 #define SPIIF_NUMBER_OF_CHANNELS          1u
 
 /* Channel 0 */
-#define SPIIF_JOB_QUEUE_SIZE0             1u
+/* Each user of the bus has at most one job chain queued, so the queue holds
+ *  one chain per user: SpiFlash and up to three further device drivers.
+ *  Jobs, which do not fit, stay reverted and are enqueued again by the user */
+#define SPIIF_NUMBER_OF_USERS0            4u
+#define SPIIF_JOB_QUEUE_SIZE0             SPIIF_NUMBER_OF_USERS0
 #define SPIIF_SPI_CHANNEL_NUMBER0         1
 #define SPIIF_RX_NOTIFIER0                NULL_PTR
+#define SPIIF_DMA_USED0                   TRUE
 #define SPIIF_DATA_SIZE0                  SPI_DataSize_8b
 #define SPIIF_CPOL                        SPI_CPOL_Low
 #define SPIIF_CPHA                        SPI_CPHA_1Edge
 #define SPIIF_BAUDRATE_PRESCALER          SPI_BaudRatePrescaler_2
 #define SPIIF_FIRST_BIT                   SPI_FirstBit_MSB
 
+/* Busy wait calibration for inter item delays (48 MHz, 4 cycles per loop) */
+#define SPIIF_DELAY_LOOPS_PER_US          12u
+
+/* Devices */
+#define SPIIF_NUMBER_OF_DEVICES           1u
+
+/* Device 0 */
+#define SPIIF_DEVICE_CS0                  GpioIf_ChannelA04
+#define SPIIF_DEVICE_CPOL0                SPI_CPOL_Low
+#define SPIIF_DEVICE_CPHA0                SPI_CPHA_1Edge
+#define SPIIF_DEVICE_BAUDRATE_PRESCALER0  SPI_BaudRatePrescaler_2
+#define SPIIF_DEVICE_DATA_SIZE0           SPI_DataSize_8b
+#define SPIIF_DEVICE_FIRST_BIT0           SPI_FirstBit_MSB
+#define SPIIF_DEVICE_INTER_ITEM_DELAY0    0u
+
 #endif
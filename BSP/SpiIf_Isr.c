@@ -28,6 +28,8 @@
 
 void SPI1_IRQHandler(void);
 void SPI2_IRQHandler(void);
+void DMA1_Channel2_3_IRQHandler(void);
+void DMA1_Channel4_5_IRQHandler(void);
 
 /****************************************************************
  * Global variables
@@ -51,6 +53,16 @@ void SPI2_IRQHandler(void)
   SpiIf_Isr(2);
 }
 
+void DMA1_Channel2_3_IRQHandler(void)
+{
+  SpiIf_DmaIsr(1);
+}
+
+void DMA1_Channel4_5_IRQHandler(void)
+{
+  SpiIf_DmaIsr(2);
+}
+
 /****************************************************************
  * Static functions
  ***************************************************************/
@@ -12,6 +12,7 @@
  */
 
 #include "TimerIf.h"
+#include "stm32f0xx_conf.h"
 
 /****************************************************************
  * Type definitions
@@ -21,16 +22,128 @@
  * Macros
  ***************************************************************/
 
+/**
+ * Critical section for the event heap, which is used from any priority.
+ */
+#define TIMERIF_ENTER_EVENT_CS(primask)                                        \
+  do                                                                           \
+  {                                                                            \
+    (primask) = __get_PRIMASK();                                               \
+    __disable_irq();                                                           \
+  } while (0)
+
+#define TIMERIF_LEAVE_EVENT_CS(primask)   __set_PRIMASK(primask)
+
+/**
+ * Checks if a timestamp was reached, valid for differences below 2^31.
+ */
+#define TIMERIF_IS_REACHED(time, now)     ((int32_t) ((time) - (now)) <= 0)
+
 /****************************************************************
  * Function declarations
  ***************************************************************/
 
+/**
+ * Counts an overflow of the timestamp channel.
+ * @param channelConfig The timestamp channel.
+ */
+static void TimerIf_CountOverflow(TimerIf_ChannelConfigType* channelConfig);
+
+/**
+ * Initializes a PWM output and its pin.
+ * @param pwm The PWM output.
+ */
+static void TimerIf_InitPwm(const uint8_t pwm);
+
+/**
+ * Initializes an input capture and its pin.
+ * @param capture The input capture.
+ */
+static void TimerIf_InitCapture(const uint8_t capture);
+
+/**
+ * Drops all samples of an input capture, the next edge starts a new
+ *  measurement.
+ * @param capture The input capture.
+ */
+static void TimerIf_ArmCapture(const uint8_t capture);
+
+/**
+ * Routes a pin to a timer.
+ * @param pin The pin.
+ * @param alternateFunction The alternate function of the timer.
+ */
+static void TimerIf_InitPin(const GpioIf_ChannelType pin,
+                            const GpioIf_AlternateFunctionType alternateFunction);
+
+/**
+ * Stores the sample of an input capture without DMA.
+ * @param channel The timer channel.
+ */
+static void TimerIf_CaptureIsr(const uint8_t channel);
+
+/**
+ * Runs the expired events and programs the next compare match.
+ * @param registers The timestamp channel.
+ */
+static void TimerIf_EventIsr(TimerIf_TimerRegisterType* registers);
+
+/**
+ * Programs the compare unit for the first event of the heap.
+ * @param registers The timestamp channel.
+ */
+static void TimerIf_ProgramEvent(TimerIf_TimerRegisterType* registers);
+
+/**
+ * Places an event at a heap position and moves it up to its order.
+ * @param event The event.
+ * @param idx The start position.
+ */
+static void TimerIf_HeapUp(TimerIf_EventType* event, uint8_t idx);
+
+/**
+ * Places an event at a heap position and moves it down to its order.
+ * @param event The event.
+ * @param idx The start position.
+ */
+static void TimerIf_HeapDown(TimerIf_EventType* event, uint8_t idx);
+
+/**
+ * Removes the event at a heap position.
+ * @param idx The position.
+ */
+static void TimerIf_HeapRemove(uint8_t idx);
+
+/**
+ * Checks if a timer channel needs its NVIC interrupt (update or capture).
+ * @param channel The timer channel.
+ * @return TRUE if the interrupt is needed; otherwise FALSE.
+ */
+static BOOL TimerIf_IsNvicUsed(const uint8_t channel);
+
+/**
+ * Checks if a timer channel needs its update interrupt.
+ * @param channel The timer channel.
+ * @return TRUE if the interrupt is needed; otherwise FALSE.
+ */
+static BOOL TimerIf_IsIsrUsed(const uint8_t channel);
+
 /****************************************************************
  * Global variables
  ***************************************************************/
 
 static TimerIf_ConfigType* TimerIf_userCfg = NULL_PTR;
 
+/**
+ * Overflows of the timestamp channel, the upper 32 bit of the timestamp.
+ */
+static volatile uint32_t TimerIf_timestampOverflows = 0u;
+
+/**
+ * Number of scheduled events.
+ */
+static uint8_t TimerIf_eventCount = 0u;
+
 /****************************************************************
  * User functions
  ***************************************************************/
@@ -39,6 +152,8 @@ void TimerIf_Init(TimerIf_ConfigType* config)
 {
   /* Local variables */
   uint8_t i;
+  uint8_t pwm;
+  uint8_t capture;
   TimerIf_ChannelConfigType* channelConfig;
   BOOL enabled;
 
@@ -70,6 +185,24 @@ void TimerIf_Init(TimerIf_ConfigType* config)
       /* Set priority in any case */
       NVIC_SetPriority(channelConfig->nvicIrq, 2u);
 
+      /* Initialize the PWM outputs of this timer */
+      for (pwm = 0u; pwm < config->numberOfPwms; pwm++)
+      {
+        if (config->pwmConfigs[pwm].channel == i)
+        {
+          TimerIf_InitPwm(pwm);
+        }
+      }
+
+      /* Initialize the input captures of this timer */
+      for (capture = 0u; capture < config->numberOfCaptures; capture++)
+      {
+        if (config->captureConfigs[capture].channel == i)
+        {
+          TimerIf_InitCapture(capture);
+        }
+      }
+
       /* If timer is enabled, start it. */
       if (enabled)
       {
@@ -87,6 +220,7 @@ BOOL TimerIf_Start(const uint8_t channel)
 {
   /* Local variables */
   BOOL ret;
+  uint8_t capture;
   TimerIf_ChannelConfigType* channelConfig;
 
   /* Initialize local variables */
@@ -98,9 +232,24 @@ BOOL TimerIf_Start(const uint8_t channel)
   {
     channelConfig = &TimerIf_userCfg->channelConfigs[channel];
 
-    /* Enable interrupt */
-    TIM_ITConfig(channelConfig->registers, TIM_IT_Update, ENABLE);
-    NVIC_EnableIRQ(channelConfig->nvicIrq);
+    /* The counter value at start is arbitrary, restart the measurements */
+    for (capture = 0u; capture < TimerIf_userCfg->numberOfCaptures; capture++)
+    {
+      if (TimerIf_userCfg->captureConfigs[capture].channel == channel)
+      {
+        TimerIf_ArmCapture(capture);
+      }
+    }
+
+    /* Enable interrupt, PWM only timers run without */
+    if (TimerIf_IsIsrUsed(channel))
+    {
+      TIM_ITConfig(channelConfig->registers, TIM_IT_Update, ENABLE);
+    }
+    if (TimerIf_IsNvicUsed(channel))
+    {
+      NVIC_EnableIRQ(channelConfig->nvicIrq);
+    }
 
     /* Enable timer */
     TIM_Cmd(channelConfig->registers, ENABLE);
@@ -171,8 +320,15 @@ BOOL TimerIf_SetFreqPeriod(const uint8_t channel,
       RCC_GetClocksFreq(&rccClocks);
 
       /* Initialize timer base */
-      timerConfig.TIM_Prescaler = (uint16_t) ((rccClocks.PCLK_Frequency
-        / channelConfig->frequency) - 1u);
+      if (channelConfig->frequency == TIMERIF_FREQUENCY_PCLK)
+      {
+        timerConfig.TIM_Prescaler = 0u;
+      }
+      else
+      {
+        timerConfig.TIM_Prescaler = (uint16_t) ((rccClocks.PCLK_Frequency
+          / channelConfig->frequency) - 1u);
+      }
       timerConfig.TIM_Period = channelConfig->period;
       timerConfig.TIM_ClockDivision = channelConfig->clockDivision;
       timerConfig.TIM_CounterMode = channelConfig->counterMode;
@@ -203,6 +359,237 @@ BOOL TimerIf_Reset(const uint8_t channel)
   return ret;
 }
 
+BOOL TimerIf_SetDuty(const uint8_t pwm, const TimerIf_DutyType duty)
+{
+  /* Local variables */
+  BOOL ret;
+  TimerIf_PwmConfigType* pwmConfig;
+  TimerIf_TimerRegisterType* registers;
+  uint32_t compare;
+
+  /* Initialize local variables */
+  ret = FALSE;
+
+  if ((TimerIf_userCfg != NULL_PTR) && (pwm < TimerIf_userCfg->numberOfPwms)
+    && (duty <= TIMERIF_DUTY_MAX))
+  {
+    pwmConfig = &TimerIf_userCfg->pwmConfigs[pwm];
+    registers = TimerIf_userCfg->channelConfigs[pwmConfig->channel].registers;
+    pwmConfig->duty = duty;
+
+    /* Compare value relative to the period, ARR + 1 counts are 100 % */
+    compare = (uint32_t) ((((uint64_t) registers->ARR + 1u) * duty)
+      / TIMERIF_DUTY_MAX);
+
+    /* Written to the preload register, applied at the next update event */
+    switch (pwmConfig->output)
+    {
+    case 1u:
+      registers->CCR1 = compare;
+      break;
+    case 2u:
+      registers->CCR2 = compare;
+      break;
+    case 3u:
+      registers->CCR3 = compare;
+      break;
+    default:
+      registers->CCR4 = compare;
+      break;
+    }
+
+    /* A stopped timer has no update event, load the compare value now */
+    if (!TimerIf_userCfg->channelConfigs[pwmConfig->channel].enabled)
+    {
+      TIM_GenerateEvent(registers, TIM_EventSource_Update);
+    }
+
+    ret = TRUE;
+  }
+
+  return ret;
+}
+
+BOOL TimerIf_GetCapture(const uint8_t capture, TimerIf_PeriodType* period,
+                        TimerIf_DutyType* duty)
+{
+  /* Local variables */
+  BOOL ret;
+  uint8_t i;
+  uint8_t count;
+  uint64_t periodSum;
+  uint64_t widthSum;
+  TimerIf_CaptureSampleType sample;
+  TimerIf_CaptureConfigType* captureConfig;
+
+  /* Initialize local variables */
+  ret = FALSE;
+  count = 0u;
+  periodSum = 0u;
+  widthSum = 0u;
+
+  if ((TimerIf_userCfg != NULL_PTR)
+    && (capture < TimerIf_userCfg->numberOfCaptures)
+    && (period != NULL_PTR) && (duty != NULL_PTR))
+  {
+    captureConfig = &TimerIf_userCfg->captureConfigs[capture];
+
+    /* The update flag is only set by a counter overflow, no rising edge for
+     * the full counter range: the signal stopped or is too slow */
+    TimerIf_EnterCS(captureConfig->channel);
+    if ((TimerIf_userCfg->channelConfigs[captureConfig->channel].registers->SR
+      & TIM_SR_UIF) != 0u)
+    {
+      TimerIf_ArmCapture(capture);
+    }
+    TimerIf_LeaveCS(captureConfig->channel);
+
+    /* Average all samples of the ring, the ring is the filter window */
+    for (i = 0u; i < captureConfig->numberOfSamples; i++)
+    {
+      /* Copy with the capture interrupt blocked, DMA bursts are atomic
+       * enough for an average */
+      TimerIf_EnterCS(captureConfig->channel);
+      sample = captureConfig->samples[i];
+      TimerIf_LeaveCS(captureConfig->channel);
+
+      if (sample.period != 0u)
+      {
+        periodSum += sample.period;
+        widthSum += sample.pulseWidth;
+        count++;
+      }
+    }
+
+    if (count > 0u)
+    {
+      *period = (TimerIf_PeriodType) (periodSum / count);
+      *duty = (TimerIf_DutyType) ((widthSum * TIMERIF_DUTY_MAX) / periodSum);
+      ret = TRUE;
+    }
+  }
+
+  return ret;
+}
+
+uint32_t TimerIf_GetTimestamp(void)
+{
+  /* Local variables */
+  uint32_t ret;
+
+  /* Initialize local variables */
+  ret = 0u;
+
+  if ((TimerIf_userCfg != NULL_PTR)
+    && (TimerIf_userCfg->timestampChannel < TimerIf_userCfg->numberOfChannels))
+  {
+    ret = TimerIf_userCfg->channelConfigs[TimerIf_userCfg->timestampChannel]
+      .registers->CNT;
+  }
+
+  return ret;
+}
+
+uint64_t TimerIf_GetTimestamp64(void)
+{
+  /* Local variables */
+  uint64_t ret;
+  uint32_t high;
+  uint32_t low;
+  BOOL overflowPending;
+  TimerIf_TimerRegisterType* registers;
+
+  /* Initialize local variables */
+  ret = 0u;
+
+  if ((TimerIf_userCfg != NULL_PTR)
+    && (TimerIf_userCfg->timestampChannel < TimerIf_userCfg->numberOfChannels))
+  {
+    registers = TimerIf_userCfg->channelConfigs[TimerIf_userCfg->timestampChannel]
+      .registers;
+
+    /* Retry if the interrupt counted an overflow in between */
+    do
+    {
+      high = TimerIf_timestampOverflows;
+      low = registers->CNT;
+      overflowPending = (BOOL) ((registers->SR & TIM_SR_UIF) != 0u);
+    } while (high != TimerIf_timestampOverflows);
+
+    /* Interrupt blocked: the overflow is not counted yet, but belongs to
+     * the value if the counter wrapped before it was read */
+    if (overflowPending && (low < 0x80000000u))
+    {
+      high++;
+    }
+
+    ret = ((uint64_t) high << 32u) | low;
+  }
+
+  return ret;
+}
+
+BOOL TimerIf_ScheduleEvent(TimerIf_EventType* event, const uint32_t delay)
+{
+  /* Local variables */
+  BOOL ret;
+  uint32_t primask;
+  TimerIf_TimerRegisterType* registers;
+
+  /* Initialize local variables */
+  ret = FALSE;
+
+  if ((TimerIf_userCfg != NULL_PTR) && (event != NULL_PTR)
+    && (TimerIf_userCfg->timestampChannel < TimerIf_userCfg->numberOfChannels))
+  {
+    registers = TimerIf_userCfg->channelConfigs[TimerIf_userCfg->timestampChannel]
+      .registers;
+
+    TIMERIF_ENTER_EVENT_CS(primask);
+    if ((event->heapIdx == TIMERIF_EVENT_IDLE)
+      && (TimerIf_eventCount < TimerIf_userCfg->eventHeapSize))
+    {
+      event->time = registers->CNT + delay;
+      TimerIf_eventCount++;
+      TimerIf_HeapUp(event, (uint8_t) (TimerIf_eventCount - 1u));
+
+      /* New first event: move the compare match */
+      if (event->heapIdx == 0u)
+      {
+        TimerIf_ProgramEvent(registers);
+      }
+      ret = TRUE;
+    }
+    TIMERIF_LEAVE_EVENT_CS(primask);
+  }
+
+  return ret;
+}
+
+BOOL TimerIf_CancelEvent(TimerIf_EventType* event)
+{
+  /* Local variables */
+  BOOL ret;
+  uint32_t primask;
+
+  /* Initialize local variables */
+  ret = FALSE;
+
+  if ((TimerIf_userCfg != NULL_PTR) && (event != NULL_PTR))
+  {
+    TIMERIF_ENTER_EVENT_CS(primask);
+    if (event->heapIdx != TIMERIF_EVENT_IDLE)
+    {
+      /* A stale compare match only causes an interrupt without events */
+      TimerIf_HeapRemove(event->heapIdx);
+      ret = TRUE;
+    }
+    TIMERIF_LEAVE_EVENT_CS(primask);
+  }
+
+  return ret;
+}
+
 void TimerIf_EnterCS(const uint8_t channel)
 {
   /* Check configuration */
@@ -220,8 +607,9 @@ void TimerIf_LeaveCS(const uint8_t channel)
   if ((TimerIf_userCfg != NULL_PTR)
     && (channel < TimerIf_userCfg->numberOfChannels))
   {
-    /* Enable timer interrupt if the timer is enabled. */
-    if (TimerIf_userCfg->channelConfigs[channel].enabled)
+    /* Enable timer interrupt if the timer is enabled and uses it. */
+    if (TimerIf_userCfg->channelConfigs[channel].enabled
+      && TimerIf_IsNvicUsed(channel))
     {
       NVIC_EnableIRQ(TimerIf_userCfg->channelConfigs[channel].nvicIrq);
     }
@@ -246,14 +634,39 @@ void TimerIf_Isr(const uint8_t channel)
   {
     channelConfig = &TimerIf_userCfg->channelConfigs[channel];
 
+    /* Compare 1 runs events on the timestamp channel, otherwise it stores
+     * samples of input captures without DMA */
+    if ((channelConfig->registers->SR & TIM_SR_CC1IF) != 0u)
+    {
+      if (channel == TimerIf_userCfg->timestampChannel)
+      {
+        TimerIf_EventIsr(channelConfig->registers);
+      }
+      else
+      {
+        TimerIf_CaptureIsr(channel);
+      }
+    }
+
+    /* Count overflows of the timestamp channel */
+    if ((channel == TimerIf_userCfg->timestampChannel)
+      && ((channelConfig->registers->SR & TIM_SR_UIF) != 0u))
+    {
+      TimerIf_CountOverflow(channelConfig);
+    }
+
     /* Call ISR callback */
     if (channelConfig->isrCallback != NULL_PTR)
     {
       channelConfig->isrCallback();
     }
 
-    /* Clear pending bit */
-    TIM_ClearITPendingBit(channelConfig->registers, TIM_IT_Update);
+    /* Clear pending bit. The timestamp channel clears it only together with
+     * the overflow count, an overflow during the callback stays pending */
+    if (channel != TimerIf_userCfg->timestampChannel)
+    {
+      TIM_ClearITPendingBit(channelConfig->registers, TIM_IT_Update);
+    }
   }
 }
 
@@ -261,3 +674,417 @@ void TimerIf_Isr(const uint8_t channel)
  * Static functions
  ***************************************************************/
 
+static void TimerIf_InitPwm(const uint8_t pwm)
+{
+  /* Local variables */
+  TimerIf_PwmConfigType* pwmConfig;
+  TimerIf_TimerRegisterType* registers;
+  TIM_OCInitTypeDef ocConfig;
+
+  /* Initialize local variables */
+  pwmConfig = &TimerIf_userCfg->pwmConfigs[pwm];
+  registers = TimerIf_userCfg->channelConfigs[pwmConfig->channel].registers;
+
+  /* Route the pin to the timer */
+  TimerIf_InitPin(pwmConfig->pin, pwmConfig->alternateFunction);
+
+  /* PWM mode 1: active while the counter is below the compare value */
+  ocConfig.TIM_OCMode = TIM_OCMode_PWM1;
+  ocConfig.TIM_OutputState = TIM_OutputState_Enable;
+  ocConfig.TIM_OutputNState = TIM_OutputNState_Disable;
+  ocConfig.TIM_Pulse = 0u;
+  ocConfig.TIM_OCPolarity = pwmConfig->polarity;
+  ocConfig.TIM_OCNPolarity = TIM_OCNPolarity_High;
+  ocConfig.TIM_OCIdleState = TIM_OCIdleState_Reset;
+  ocConfig.TIM_OCNIdleState = TIM_OCNIdleState_Reset;
+
+  switch (pwmConfig->output)
+  {
+  case 1u:
+    TIM_OC1Init(registers, &ocConfig);
+    TIM_OC1PreloadConfig(registers, TIM_OCPreload_Enable);
+    break;
+  case 2u:
+    TIM_OC2Init(registers, &ocConfig);
+    TIM_OC2PreloadConfig(registers, TIM_OCPreload_Enable);
+    break;
+  case 3u:
+    TIM_OC3Init(registers, &ocConfig);
+    TIM_OC3PreloadConfig(registers, TIM_OCPreload_Enable);
+    break;
+  case 4u:
+    TIM_OC4Init(registers, &ocConfig);
+    TIM_OC4PreloadConfig(registers, TIM_OCPreload_Enable);
+    break;
+  default:
+    /* Wrong output configuration */
+    assert_param(FALSE);
+    break;
+  }
+
+  /* Preload the period too, so period changes are glitch free as well */
+  TIM_ARRPreloadConfig(registers, ENABLE);
+
+  /* Timers with break function need the main output enable */
+  if ((registers == TIM1) || (registers == TIM15) || (registers == TIM16)
+    || (registers == TIM17))
+  {
+    TIM_CtrlPWMOutputs(registers, ENABLE);
+  }
+
+  TimerIf_SetDuty(pwm, pwmConfig->duty);
+}
+
+static void TimerIf_InitCapture(const uint8_t capture)
+{
+  /* Local variables */
+  TimerIf_CaptureConfigType* captureConfig;
+  TimerIf_TimerRegisterType* registers;
+  TIM_ICInitTypeDef icConfig;
+  DMA_InitTypeDef dmaConfig;
+
+  /* Initialize local variables */
+  captureConfig = &TimerIf_userCfg->captureConfigs[capture];
+  registers = TimerIf_userCfg->channelConfigs[captureConfig->channel].registers;
+
+  /* Route the pin to the timer */
+  TimerIf_InitPin(captureConfig->pin, captureConfig->alternateFunction);
+
+  /* PWM input: CCR1 latches the period (rising), CCR2 the pulse width */
+  icConfig.TIM_Channel = TIM_Channel_1;
+  icConfig.TIM_ICPolarity = TIM_ICPolarity_Rising;
+  icConfig.TIM_ICSelection = TIM_ICSelection_DirectTI;
+  icConfig.TIM_ICPrescaler = TIM_ICPSC_DIV1;
+  icConfig.TIM_ICFilter = captureConfig->filter;
+  TIM_PWMIConfig(registers, &icConfig);
+
+  /* Every rising edge restarts the counter */
+  TIM_SelectInputTrigger(registers, TIM_TS_TI1FP1);
+  TIM_SelectSlaveMode(registers, TIM_SlaveMode_Reset);
+  TIM_SelectMasterSlaveMode(registers, TIM_MasterSlaveMode_Enable);
+
+  /* Only a counter overflow sets the update flag, not the reset by an edge */
+  TIM_UpdateRequestConfig(registers, TIM_UpdateSource_Regular);
+
+  if (captureConfig->dmaChannel != NULL_PTR)
+  {
+    /* Each capture transfers CCR1 and CCR2 as burst into the ring */
+    dmaConfig.DMA_PeripheralBaseAddr = (uint32_t) &registers->DMAR;
+    dmaConfig.DMA_MemoryBaseAddr = (uint32_t) captureConfig->samples;
+    dmaConfig.DMA_DIR = DMA_DIR_PeripheralSRC;
+    dmaConfig.DMA_BufferSize = 2u * captureConfig->numberOfSamples;
+    dmaConfig.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    dmaConfig.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    dmaConfig.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+    dmaConfig.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+    dmaConfig.DMA_Mode = DMA_Mode_Circular;
+    dmaConfig.DMA_Priority = DMA_Priority_Medium;
+    dmaConfig.DMA_M2M = DMA_M2M_Disable;
+
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+    DMA_Init(captureConfig->dmaChannel, &dmaConfig);
+
+    /* The request is enabled by the capture interrupt after the first edge */
+    TIM_DMAConfig(registers, TIM_DMABase_CCR1, TIM_DMABurstLength_2Transfers);
+  }
+
+  TimerIf_ArmCapture(capture);
+}
+
+static void TimerIf_ArmCapture(const uint8_t capture)
+{
+  /* Local variables */
+  uint8_t i;
+  TimerIf_CaptureConfigType* captureConfig;
+  TimerIf_TimerRegisterType* registers;
+
+  /* Initialize local variables */
+  captureConfig = &TimerIf_userCfg->captureConfigs[capture];
+  registers = TimerIf_userCfg->channelConfigs[captureConfig->channel].registers;
+
+  /* Stop the DMA and restart it at the begin of the ring, so an interrupted
+   * burst cannot shift period and pulse width */
+  if (captureConfig->dmaChannel != NULL_PTR)
+  {
+    TIM_DMACmd(registers, TIM_DMA_CC1, DISABLE);
+    DMA_Cmd(captureConfig->dmaChannel, DISABLE);
+    DMA_SetCurrDataCounter(captureConfig->dmaChannel,
+                           (uint16_t) (2u * captureConfig->numberOfSamples));
+    DMA_Cmd(captureConfig->dmaChannel, ENABLE);
+  }
+
+  /* No samples yet */
+  for (i = 0u; i < captureConfig->numberOfSamples; i++)
+  {
+    captureConfig->samples[i].period = 0u;
+    captureConfig->samples[i].pulseWidth = 0u;
+  }
+  captureConfig->sampleIdx = 0u;
+  captureConfig->discard = TRUE;
+
+  /* The first edge is taken by the interrupt */
+  TIM_ClearFlag(registers, TIM_FLAG_Update | TIM_FLAG_CC1);
+  TIM_ITConfig(registers, TIM_IT_CC1, ENABLE);
+}
+
+static void TimerIf_InitPin(const GpioIf_ChannelType pin,
+                            const GpioIf_AlternateFunctionType alternateFunction)
+{
+  /* Local variables */
+  uint8_t port;
+  uint8_t pinNumber;
+  GPIO_InitTypeDef gpioConfig;
+
+  /* Initialize local variables */
+  port = (uint8_t) ((uint32_t) pin / GPIOIF_NUMBER_OF_PINS_PER_CHANNEL);
+  pinNumber = (uint8_t) ((uint32_t) pin % GPIOIF_NUMBER_OF_PINS_PER_CHANNEL);
+
+  RCC_AHBPeriphClockCmd(RCC_AHBPeriph_GPIOA << port, ENABLE);
+  gpioConfig.GPIO_Pin = (uint32_t) (1u << pinNumber);
+  gpioConfig.GPIO_Mode = GPIO_Mode_AF;
+  gpioConfig.GPIO_Speed = GPIO_Speed_2MHz;
+  gpioConfig.GPIO_OType = GPIO_OType_PP;
+  gpioConfig.GPIO_PuPd = GPIO_PuPd_NOPULL;
+  GPIO_Init(GPIOIF_PORT_REGISTERS(port), &gpioConfig);
+  GPIO_PinAFConfig(GPIOIF_PORT_REGISTERS(port), pinNumber, alternateFunction);
+}
+
+static void TimerIf_CaptureIsr(const uint8_t channel)
+{
+  /* Local variables */
+  uint8_t i;
+  uint32_t period;
+  uint32_t pulseWidth;
+  TimerIf_CaptureConfigType* captureConfig;
+  TimerIf_TimerRegisterType* registers;
+  TimerIf_CaptureSampleType* sample;
+
+  /* Initialize local variables */
+  registers = TimerIf_userCfg->channelConfigs[channel].registers;
+
+  for (i = 0u; i < TimerIf_userCfg->numberOfCaptures; i++)
+  {
+    captureConfig = &TimerIf_userCfg->captureConfigs[i];
+
+    if (captureConfig->channel == channel)
+    {
+      /* Reading CCR1 clears the flag */
+      pulseWidth = registers->CCR2;
+      period = registers->CCR1;
+
+      /* The counter overflowed since the last edge, the samples are stale
+       * and this one counts from the overflow */
+      if ((registers->SR & TIM_SR_UIF) != 0u)
+      {
+        TimerIf_ArmCapture(i);
+      }
+
+      if (captureConfig->discard)
+      {
+        /* This edge reset the counter, the next capture is a full period */
+        captureConfig->discard = FALSE;
+        if (captureConfig->dmaChannel != NULL_PTR)
+        {
+          TIM_ITConfig(registers, TIM_IT_CC1, DISABLE);
+          TIM_DMACmd(registers, TIM_DMA_CC1, ENABLE);
+        }
+      }
+      else if (captureConfig->dmaChannel == NULL_PTR)
+      {
+        sample = &captureConfig->samples[captureConfig->sampleIdx];
+        sample->pulseWidth = pulseWidth;
+        sample->period = period;
+
+        captureConfig->sampleIdx++;
+        if (captureConfig->sampleIdx >= captureConfig->numberOfSamples)
+        {
+          captureConfig->sampleIdx = 0u;
+        }
+      }
+    }
+  }
+}
+
+static void TimerIf_EventIsr(TimerIf_TimerRegisterType* registers)
+{
+  /* Local variables */
+  uint32_t primask;
+  TimerIf_EventType* event;
+
+  /* Clear the compare flag first, matches during the callbacks stay */
+  registers->SR = (uint16_t) ~TIM_SR_CC1IF;
+
+  do
+  {
+    event = NULL_PTR;
+
+    TIMERIF_ENTER_EVENT_CS(primask);
+    if ((TimerIf_eventCount > 0u)
+      && TIMERIF_IS_REACHED(TimerIf_userCfg->eventHeap[0]->time, registers->CNT))
+    {
+      event = TimerIf_userCfg->eventHeap[0];
+      TimerIf_HeapRemove(0u);
+    }
+    else
+    {
+      TimerIf_ProgramEvent(registers);
+    }
+    TIMERIF_LEAVE_EVENT_CS(primask);
+
+    /* Callbacks run outside the critical section and may reschedule */
+    if ((event != NULL_PTR) && (event->callback != NULL_PTR))
+    {
+      event->callback();
+    }
+  } while (event != NULL_PTR);
+}
+
+static void TimerIf_ProgramEvent(TimerIf_TimerRegisterType* registers)
+{
+  if (TimerIf_eventCount > 0u)
+  {
+    registers->CCR1 = TimerIf_userCfg->eventHeap[0]->time;
+    registers->DIER |= TIM_DIER_CC1IE;
+
+    /* Already passed while programming: trigger the match by software */
+    if (TIMERIF_IS_REACHED(TimerIf_userCfg->eventHeap[0]->time, registers->CNT))
+    {
+      registers->EGR = TIM_EGR_CC1G;
+    }
+  }
+  else
+  {
+    registers->DIER &= (uint16_t) ~TIM_DIER_CC1IE;
+  }
+}
+
+static void TimerIf_HeapUp(TimerIf_EventType* event, uint8_t idx)
+{
+  /* Local variables */
+  uint8_t parent;
+  TimerIf_EventType** heap;
+
+  /* Initialize local variables */
+  heap = TimerIf_userCfg->eventHeap;
+
+  while (idx > 0u)
+  {
+    parent = (uint8_t) ((idx - 1u) / 2u);
+    if (!TIMERIF_IS_REACHED(event->time, heap[parent]->time))
+    {
+      break;
+    }
+    /* Earlier than its parent, move the parent down */
+    heap[idx] = heap[parent];
+    heap[idx]->heapIdx = idx;
+    idx = parent;
+  }
+
+  heap[idx] = event;
+  event->heapIdx = idx;
+}
+
+static void TimerIf_HeapDown(TimerIf_EventType* event, uint8_t idx)
+{
+  /* Local variables */
+  uint8_t child;
+  TimerIf_EventType** heap;
+
+  /* Initialize local variables */
+  heap = TimerIf_userCfg->eventHeap;
+
+  for (;;)
+  {
+    child = (uint8_t) ((2u * idx) + 1u);
+    if (child >= TimerIf_eventCount)
+    {
+      break;
+    }
+    /* Take the earlier child */
+    if (((child + 1u) < TimerIf_eventCount)
+      && !TIMERIF_IS_REACHED(heap[child]->time, heap[child + 1u]->time))
+    {
+      child++;
+    }
+    if (TIMERIF_IS_REACHED(event->time, heap[child]->time))
+    {
+      break;
+    }
+    heap[idx] = heap[child];
+    heap[idx]->heapIdx = idx;
+    idx = child;
+  }
+
+  heap[idx] = event;
+  event->heapIdx = idx;
+}
+
+static void TimerIf_HeapRemove(uint8_t idx)
+{
+  /* Local variables */
+  TimerIf_EventType** heap;
+  TimerIf_EventType* last;
+
+  /* Initialize local variables */
+  heap = TimerIf_userCfg->eventHeap;
+
+  heap[idx]->heapIdx = TIMERIF_EVENT_IDLE;
+  TimerIf_eventCount--;
+
+  /* Fill the gap with the last event, which moves up or down */
+  if (idx < TimerIf_eventCount)
+  {
+    last = heap[TimerIf_eventCount];
+    if ((idx > 0u)
+      && TIMERIF_IS_REACHED(last->time, heap[(idx - 1u) / 2u]->time))
+    {
+      TimerIf_HeapUp(last, idx);
+    }
+    else
+    {
+      TimerIf_HeapDown(last, idx);
+    }
+  }
+}
+
+static BOOL TimerIf_IsNvicUsed(const uint8_t channel)
+{
+  /* Local variables */
+  BOOL ret;
+  uint8_t i;
+
+  /* Initialize local variables */
+  ret = TimerIf_IsIsrUsed(channel);
+
+  for (i = 0u; i < TimerIf_userCfg->numberOfCaptures; i++)
+  {
+    /* The first edge of a capture is taken by the interrupt, with DMA too */
+    if (TimerIf_userCfg->captureConfigs[i].channel == channel)
+    {
+      ret = TRUE;
+    }
+  }
+
+  return ret;
+}
+
+static BOOL TimerIf_IsIsrUsed(const uint8_t channel)
+{
+  return (BOOL) ((TimerIf_userCfg->channelConfigs[channel].isrCallback != NULL_PTR)
+    || (channel == TimerIf_userCfg->timestampChannel));
+}
+
+static void TimerIf_CountOverflow(TimerIf_ChannelConfigType* channelConfig)
+{
+  /* Local variables */
+  uint32_t primask;
+
+  /* Flag and counter change together, so readers in higher priority
+   * interrupts see either the pending flag or the counted overflow */
+  primask = __get_PRIMASK();
+  __disable_irq();
+  channelConfig->registers->SR = (uint16_t) ~TIM_SR_UIF;
+  TimerIf_timestampOverflows++;
+  __set_PRIMASK(primask);
+}
+
@@ -18,6 +18,9 @@
 
 #include "stm32f0xx_tim.h"
 #include "stm32f0xx_rcc.h"
+#include "stm32f0xx_dma.h"
+
+#include "GpioIf.h"
 
 /****************************************************************
  * Type definitions
@@ -90,6 +93,89 @@ typedef struct
   TimerIf_CounterModeType counterMode;
 } TimerIf_ChannelConfigType;
 
+/**
+ * Defines the PWM duty cycle type, 0 ... TIMERIF_DUTY_MAX.
+ */
+typedef uint16_t TimerIf_DutyType;
+
+/**
+ * Defines one PWM output (output compare channel of a timer channel). The
+ *  frequency is the one of the timer channel, frequency / (period + 1).
+ */
+typedef struct
+{
+  /* The timer channel. */
+  const uint8_t channel;
+  /* The output compare channel of the timer (1 ... 4). */
+  const uint8_t output;
+  /* The output polarity (TIM_OCPolarity_High or TIM_OCPolarity_Low). */
+  const uint16_t polarity;
+  /* The output pin and its alternate function. */
+  const GpioIf_ChannelType pin;
+  const GpioIf_AlternateFunctionType alternateFunction;
+  /* The duty cycle at startup. */
+  TimerIf_DutyType duty;
+} TimerIf_PwmConfigType;
+
+/**
+ * One captured period of an input signal, in timer counts.
+ */
+typedef struct
+{
+  /* Rising to rising edge. */
+  uint32_t period;
+  /* Rising to falling edge. */
+  uint32_t pulseWidth;
+} TimerIf_CaptureSampleType;
+
+/**
+ * Defines one input capture (PWM input mode on input 1 of a timer channel).
+ *  The timer is reset by every rising edge and latches period and pulse
+ *  width in hardware. The samples are written by DMA (burst of CCR1 and
+ *  CCR2) or, without DMA channel, by the capture interrupt. The first edge
+ *  of a measurement is always taken by the capture interrupt. A counter
+ *  overflow (no rising edge within period + 1 counts) drops all samples.
+ */
+typedef struct
+{
+  /* The timer channel, used for this capture only. */
+  const uint8_t channel;
+  /* The input pin and its alternate function. */
+  const GpioIf_ChannelType pin;
+  const GpioIf_AlternateFunctionType alternateFunction;
+  /* The input filter (0 ... 15). */
+  const uint16_t filter;
+  /* The DMA channel of the CC1 request, NULL_PTR to use the interrupt. */
+  DMA_Channel_TypeDef* const dmaChannel;
+  /* The sample ring, averaged by TimerIf_GetCapture. */
+  TimerIf_CaptureSampleType* const samples;
+  const uint8_t numberOfSamples;
+  /* Next sample written by the interrupt. */
+  volatile uint8_t sampleIdx;
+  /* The next capture is dropped, it measures from an arbitrary counter
+   * value (after start or a counter overflow). */
+  volatile BOOL discard;
+} TimerIf_CaptureConfigType;
+
+/**
+ * Defines a function pointer for event callbacks.
+ */
+typedef void (*TimerIf_EventCallbackType)(void);
+
+/**
+ * One-shot event on the timestamp channel. The event is owned by the caller
+ *  and has to stay valid while it is scheduled.
+ */
+typedef struct
+{
+  /* The callback, called from the timer interrupt. */
+  TimerIf_EventCallbackType callback;
+  /* The timestamp (lower 32 bit) of the expiry. */
+  uint32_t time;
+  /* Position in the event heap, TIMERIF_EVENT_IDLE if not scheduled. */
+  uint8_t heapIdx;
+} TimerIf_EventType;
+
 /**
  * Defines the configuration of the timer interface.
  */
@@ -99,12 +185,52 @@ typedef struct
   const uint8_t numberOfChannels;
   /* The channel configurations. */
   TimerIf_ChannelConfigType* channelConfigs;
+  /* Free running channel used for timestamps, TIMERIF_CHANNEL_NONE if
+   * unused. Its period has to be the full counter range. */
+  const uint8_t timestampChannel;
+  /* The number of PWM outputs. */
+  const uint8_t numberOfPwms;
+  /* The PWM output configurations. */
+  TimerIf_PwmConfigType* pwmConfigs;
+  /* The number of input captures. */
+  const uint8_t numberOfCaptures;
+  /* The input capture configurations. */
+  TimerIf_CaptureConfigType* captureConfigs;
+  /* Min heap of the scheduled events, ordered by expiry. */
+  TimerIf_EventType** const eventHeap;
+  const uint8_t eventHeapSize;
 } TimerIf_ConfigType;
 
 /****************************************************************
  * Macros                                                       *
  ***************************************************************/
 
+/**
+ * Marks an unused channel reference in the configuration.
+ */
+#define TIMERIF_CHANNEL_NONE                                  0xFFu
+
+/**
+ * Defines the duty cycle of 100 %.
+ */
+#define TIMERIF_DUTY_MAX                                      10000u
+
+/**
+ * Channel frequency to count with the undivided PCLK (prescaler 0).
+ */
+#define TIMERIF_FREQUENCY_PCLK                                0u
+
+/**
+ * Marks an event which is not scheduled.
+ */
+#define TIMERIF_EVENT_IDLE                                    0xFFu
+
+/**
+ * Static initializer of an event.
+ * @param callback The callback of the event.
+ */
+#define TIMERIF_EVENT_INIT(callback)      { (callback), 0u, TIMERIF_EVENT_IDLE }
+
 /****************************************************************
  * Global variables
  ***************************************************************/
@@ -124,7 +250,7 @@ extern TimerIf_ConfigType TimerIf_config;
  */
 void TimerIf_Init(TimerIf_ConfigType* config);
 /**
- * Starts a timer channel.
+ * Starts a timer channel. Its input captures start a new measurement.
  * @param channel The channel which should be started.
  * @return TRUE if the operation succeeded; otherwise FALSE.
  */
@@ -138,7 +264,8 @@ BOOL TimerIf_Stop(const uint8_t channel);
 /**
  * Sets the period and the frequency of a timer channel.
  * @param channel The timer channel which should be changed.
- * @param frequency The new frequency.
+ * @param frequency The new frequency, TIMERIF_FREQUENCY_PCLK for the
+ *  undivided PCLK.
  * @param period The new period.
  * @return TRUE if the operation succeeded; otherwise FALSE.
  */
@@ -152,6 +279,57 @@ BOOL TimerIf_SetFreqPeriod(const uint8_t channel,
  */
 BOOL TimerIf_Reset(const uint8_t channel);
 
+/**
+ * Sets the duty cycle of a PWM output. The compare register is preloaded,
+ *  the new duty cycle starts with the next period (no glitches). On a
+ *  stopped timer channel it is loaded at once and the counter restarts.
+ * @param pwm The PWM output.
+ * @param duty The duty cycle, TIMERIF_DUTY_MAX is 100 %.
+ * @return TRUE if the operation succeeded; otherwise FALSE.
+ */
+BOOL TimerIf_SetDuty(const uint8_t pwm, const TimerIf_DutyType duty);
+
+/**
+ * Gets the averaged period and duty cycle of an input capture. Samples not
+ *  captured yet are skipped. All samples are dropped if the signal stops or
+ *  its period exceeds the counter range, and when the timer is started.
+ * @param capture The input capture.
+ * @param period Returns the average period in timer counts, the frequency
+ *  is the timer channel frequency divided by it.
+ * @param duty Returns the average duty cycle, TIMERIF_DUTY_MAX is 100 %.
+ * @return TRUE if at least one sample was captured; otherwise FALSE.
+ */
+BOOL TimerIf_GetCapture(const uint8_t capture, TimerIf_PeriodType* period,
+                        TimerIf_DutyType* duty);
+
+/**
+ * Gets the counter of the timestamp channel, may be called from interrupts.
+ *  The resolution is the frequency of the timestamp channel.
+ * @return The timestamp, 0 if no timestamp channel is configured.
+ */
+uint32_t TimerIf_GetTimestamp(void);
+/**
+ * Gets the timestamp extended by the counted overflows to 64 bit, may be
+ *  called from interrupts (also with the timer interrupt blocked).
+ * @return The timestamp, 0 if no timestamp channel is configured.
+ */
+uint64_t TimerIf_GetTimestamp64(void);
+
+/**
+ * Schedules a one-shot event on the compare unit of the timestamp channel,
+ *  O(log n). May be called from any context, also from event callbacks.
+ * @param event The event, not scheduled yet.
+ * @param delay The delay in timestamp counts, less than 2^31.
+ * @return TRUE if the event was scheduled; otherwise FALSE.
+ */
+BOOL TimerIf_ScheduleEvent(TimerIf_EventType* event, const uint32_t delay);
+/**
+ * Cancels a scheduled event, O(log n). May be called from any context.
+ * @param event The event.
+ * @return TRUE if the event was scheduled; otherwise FALSE.
+ */
+BOOL TimerIf_CancelEvent(TimerIf_EventType* event);
+
 /**
  * Enters the critical section of the timer.
  * @param channel The used channel.
@@ -36,29 +36,122 @@ extern void CounterIf_TimerIsr0(void);
  * Global variables
  ***************************************************************/
 
-//TimerIf_ChannelConfigType TimerIf_channelConfigs[TIMERIF_NUMBER_OF_CHANNELS] =
+TimerIf_ChannelConfigType TimerIf_channelConfigs[TIMERIF_NUMBER_OF_CHANNELS] =
+{
+  {
+    TIMERIF_REGISTERS0,
+    TIMERIF_CLOCK_DOMAIN0,
+    TIMERIF_CLOCK_DOMAIN_FUNC0,
+    TIMERIF_NVIC_IRQ0,
+    TIMERIF_ISR_CALLBACK0,
+    TIMERIF_ENABLED0,
+    TIMERIF_FREQUENCY0,
+    TIMERIF_PERIOD0,
+    TIMERIF_CLOCK_DIVISION0,
+    TIMERIF_COUNTER_MODE
+  },
+  {
+    TIMERIF_REGISTERS1,
+    TIMERIF_CLOCK_DOMAIN1,
+    TIMERIF_CLOCK_DOMAIN_FUNC1,
+    TIMERIF_NVIC_IRQ1,
+    TIMERIF_ISR_CALLBACK1,
+    TIMERIF_ENABLED1,
+    TIMERIF_FREQUENCY1,
+    TIMERIF_PERIOD1,
+    TIMERIF_CLOCK_DIVISION1,
+    TIMERIF_COUNTER_MODE
+  },
+  {
+    TIMERIF_REGISTERS2,
+    TIMERIF_CLOCK_DOMAIN2,
+    TIMERIF_CLOCK_DOMAIN_FUNC2,
+    TIMERIF_NVIC_IRQ2,
+    TIMERIF_ISR_CALLBACK2,
+    TIMERIF_ENABLED2,
+    TIMERIF_FREQUENCY2,
+    TIMERIF_PERIOD2,
+    TIMERIF_CLOCK_DIVISION2,
+    TIMERIF_COUNTER_MODE
+  },
+  {
+    TIMERIF_REGISTERS3,
+    TIMERIF_CLOCK_DOMAIN3,
+    TIMERIF_CLOCK_DOMAIN_FUNC3,
+    TIMERIF_NVIC_IRQ3,
+    TIMERIF_ISR_CALLBACK3,
+    TIMERIF_ENABLED3,
+    TIMERIF_FREQUENCY3,
+    TIMERIF_PERIOD3,
+    TIMERIF_CLOCK_DIVISION3,
+    TIMERIF_COUNTER_MODE
+  }
+};
+
+TimerIf_PwmConfigType TimerIf_pwmConfigs[TIMERIF_NUMBER_OF_PWMS] =
+{
+  {
+    TIMERIF_PWM_CHANNEL0,
+    TIMERIF_PWM_OUTPUT0,
+    TIMERIF_PWM_POLARITY0,
+    TIMERIF_PWM_PIN0,
+    TIMERIF_PWM_ALTERNATE_FUNC0,
+    TIMERIF_PWM_DUTY0
+  },
+  {
+    TIMERIF_PWM_CHANNEL1,
+    TIMERIF_PWM_OUTPUT1,
+    TIMERIF_PWM_POLARITY1,
+    TIMERIF_PWM_PIN1,
+    TIMERIF_PWM_ALTERNATE_FUNC1,
+    TIMERIF_PWM_DUTY1
+  },
+  {
+    TIMERIF_PWM_CHANNEL2,
+    TIMERIF_PWM_OUTPUT2,
+    TIMERIF_PWM_POLARITY2,
+    TIMERIF_PWM_PIN2,
+    TIMERIF_PWM_ALTERNATE_FUNC2,
+    TIMERIF_PWM_DUTY2
+  }
+};
+
+//static TimerIf_CaptureSampleType TimerIf_captureSamples0[TIMERIF_CAPTURE_NUMBER_OF_SAMPLES0];
+//
+//TimerIf_CaptureConfigType TimerIf_captureConfigs[TIMERIF_NUMBER_OF_CAPTURES] =
 //{
 //  {
-//    TIMERIF_REGISTERS0,
-//    TIMERIF_CLOCK_DOMAIN0,
-//    TIMERIF_CLOCK_DOMAIN_FUNC0,
-//    TIMERIF_NVIC_IRQ0,
-//    TIMERIF_ISR_CALLBACK0,
-//    TIMERIF_ENABLED0,
-//    TIMERIF_FREQUENCY0,
-//    TIMERIF_PERIOD0,
-//    TIMERIF_CLOCK_DIVISION0,
-//    TIMERIF_COUNTER_MODE
+//    TIMERIF_CAPTURE_CHANNEL0,
+//    TIMERIF_CAPTURE_PIN0,
+//    TIMERIF_CAPTURE_ALTERNATE_FUNC0,
+//    TIMERIF_CAPTURE_FILTER0,
+//    TIMERIF_CAPTURE_DMA_CHANNEL0,
+//    TimerIf_captureSamples0,
+//    TIMERIF_CAPTURE_NUMBER_OF_SAMPLES0,
+//    0u,
+//    TRUE
 //  }
 //};
 
+/**
+ * Scheduled events of the timestamp channel.
+ */
+static TimerIf_EventType* TimerIf_eventHeap[TIMERIF_EVENT_HEAP_SIZE];
+
 /**
  * Compile time configuration.
  */
 TimerIf_ConfigType TimerIf_config =
 {
   TIMERIF_NUMBER_OF_CHANNELS,
-  NULL_PTR//TimerIf_channelConfigs
+  TimerIf_channelConfigs,
+  TIMERIF_TIMESTAMP_CHANNEL,
+  TIMERIF_NUMBER_OF_PWMS,
+  TimerIf_pwmConfigs,
+  TIMERIF_NUMBER_OF_CAPTURES,
+  NULL_PTR,//TimerIf_captureConfigs
+  TimerIf_eventHeap,
+  TIMERIF_EVENT_HEAP_SIZE
 };
 
 /****************************************************************
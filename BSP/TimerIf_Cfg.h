@@ -20,21 +20,130 @@
  * General Settings
  ***************************************************************/
 
-#define TIMERIF_NUMBER_OF_CHANNELS                            0u
+#define TIMERIF_NUMBER_OF_CHANNELS                            4u
+#define TIMERIF_TIMESTAMP_CHANNEL                             0u
+#define TIMERIF_NUMBER_OF_PWMS                                3u
+#define TIMERIF_NUMBER_OF_CAPTURES                            0u
+#define TIMERIF_EVENT_HEAP_SIZE                               8u
 
 /****************************************************************
- * Channel 0
+ * Channel 0 (free running 32 bit timestamp, 1 us resolution)
  ***************************************************************/
 
-//#define TIMERIF_REGISTERS0                                    TIM2
-//#define TIMERIF_CLOCK_DOMAIN0                                 RCC_APB1Periph_TIM2
-//#define TIMERIF_CLOCK_DOMAIN_FUNC0                            RCC_APB1PeriphClockCmd
-//#define TIMERIF_NVIC_IRQ0                                     TIM2_IRQn
-//#define TIMERIF_ISR_CALLBACK0                                 CounterIf_TimerIsr0
-//#define TIMERIF_ENABLED0                                      FALSE
-//#define TIMERIF_FREQUENCY0                                    100u
-//#define TIMERIF_PERIOD0                                       1000u
-//#define TIMERIF_CLOCK_DIVISION0                               TIM_CKD_DIV1
-//#define TIMERIF_COUNTER_MODE                                  TIM_CounterMode_Up
+#define TIMERIF_REGISTERS0                                    TIM2
+#define TIMERIF_CLOCK_DOMAIN0                                 RCC_APB1Periph_TIM2
+#define TIMERIF_CLOCK_DOMAIN_FUNC0                            RCC_APB1PeriphClockCmd
+#define TIMERIF_NVIC_IRQ0                                     TIM2_IRQn
+#define TIMERIF_ISR_CALLBACK0                                 NULL_PTR
+#define TIMERIF_ENABLED0                                      TRUE
+#define TIMERIF_FREQUENCY0                                    1000000u
+#define TIMERIF_PERIOD0                                       0xFFFFFFFFu
+#define TIMERIF_CLOCK_DIVISION0                               TIM_CKD_DIV1
+#define TIMERIF_COUNTER_MODE                                  TIM_CounterMode_Up
+
+/****************************************************************
+ * Channel 1 (Led 0 time base, 1 ms resolution, period set by Led)
+ ***************************************************************/
+
+#define TIMERIF_REGISTERS1                                    TIM17
+#define TIMERIF_CLOCK_DOMAIN1                                 RCC_APB2Periph_TIM17
+#define TIMERIF_CLOCK_DOMAIN_FUNC1                            RCC_APB2PeriphClockCmd
+#define TIMERIF_NVIC_IRQ1                                     TIM17_IRQn
+#define TIMERIF_ISR_CALLBACK1                                 NULL_PTR
+#define TIMERIF_ENABLED1                                      TRUE
+#define TIMERIF_FREQUENCY1                                    1000u
+#define TIMERIF_PERIOD1                                       999u
+#define TIMERIF_CLOCK_DIVISION1                               TIM_CKD_DIV1
+
+/****************************************************************
+ * Channel 2 (Led 1 time base)
+ ***************************************************************/
+
+#define TIMERIF_REGISTERS2                                    TIM14
+#define TIMERIF_CLOCK_DOMAIN2                                 RCC_APB1Periph_TIM14
+#define TIMERIF_CLOCK_DOMAIN_FUNC2                            RCC_APB1PeriphClockCmd
+#define TIMERIF_NVIC_IRQ2                                     TIM14_IRQn
+#define TIMERIF_ISR_CALLBACK2                                 NULL_PTR
+#define TIMERIF_ENABLED2                                      TRUE
+#define TIMERIF_FREQUENCY2                                    1000u
+#define TIMERIF_PERIOD2                                       999u
+#define TIMERIF_CLOCK_DIVISION2                               TIM_CKD_DIV1
+
+/****************************************************************
+ * Channel 3 (Led 2 time base)
+ ***************************************************************/
+
+#define TIMERIF_REGISTERS3                                    TIM3
+#define TIMERIF_CLOCK_DOMAIN3                                 RCC_APB1Periph_TIM3
+#define TIMERIF_CLOCK_DOMAIN_FUNC3                            RCC_APB1PeriphClockCmd
+#define TIMERIF_NVIC_IRQ3                                     TIM3_IRQn
+#define TIMERIF_ISR_CALLBACK3                                 NULL_PTR
+#define TIMERIF_ENABLED3                                      TRUE
+#define TIMERIF_FREQUENCY3                                    1000u
+#define TIMERIF_PERIOD3                                       999u
+#define TIMERIF_CLOCK_DIVISION3                               TIM_CKD_DIV1
+
+/****************************************************************
+ * PWM 0 (Led 0, TIM17 CH1 on PA7, active low)
+ ***************************************************************/
+
+#define TIMERIF_PWM_CHANNEL0                                  1u
+#define TIMERIF_PWM_OUTPUT0                                   1u
+#define TIMERIF_PWM_POLARITY0                                 TIM_OCPolarity_Low
+#define TIMERIF_PWM_PIN0                                      GpioIf_ChannelA07
+#define TIMERIF_PWM_ALTERNATE_FUNC0                           GPIO_AF_5
+#define TIMERIF_PWM_DUTY0                                     0u
+
+/****************************************************************
+ * PWM 1 (Led 1, TIM14 CH1 on PB1, active low)
+ ***************************************************************/
+
+#define TIMERIF_PWM_CHANNEL1                                  2u
+#define TIMERIF_PWM_OUTPUT1                                   1u
+#define TIMERIF_PWM_POLARITY1                                 TIM_OCPolarity_Low
+#define TIMERIF_PWM_PIN1                                      GpioIf_ChannelB01
+#define TIMERIF_PWM_ALTERNATE_FUNC1                           GPIO_AF_0
+#define TIMERIF_PWM_DUTY1                                     0u
+
+/****************************************************************
+ * PWM 2 (Led 2, TIM3 CH3 on PB0, active low)
+ ***************************************************************/
+
+#define TIMERIF_PWM_CHANNEL2                                  3u
+#define TIMERIF_PWM_OUTPUT2                                   3u
+#define TIMERIF_PWM_POLARITY2                                 TIM_OCPolarity_Low
+#define TIMERIF_PWM_PIN2                                      GpioIf_ChannelB00
+#define TIMERIF_PWM_ALTERNATE_FUNC2                           GPIO_AF_1
+#define TIMERIF_PWM_DUTY2                                     0u
+
+/****************************************************************
+ * Channel 4 (input capture time base, undivided PCLK for the best duty
+ * resolution; the 16 bit range limits the input to > PCLK / 65536, 733 Hz
+ * at 48 MHz). TIM1 CC interrupt, TIM1_CC_IRQHandler has to call
+ * TimerIf_Isr(4u).
+ ***************************************************************/
+
+//#define TIMERIF_REGISTERS4                                    TIM1
+//#define TIMERIF_CLOCK_DOMAIN4                                 RCC_APB2Periph_TIM1
+//#define TIMERIF_CLOCK_DOMAIN_FUNC4                            RCC_APB2PeriphClockCmd
+//#define TIMERIF_NVIC_IRQ4                                     TIM1_CC_IRQn
+//#define TIMERIF_ISR_CALLBACK4                                 NULL_PTR
+//#define TIMERIF_ENABLED4                                      TRUE
+//#define TIMERIF_FREQUENCY4                                    TIMERIF_FREQUENCY_PCLK
+//#define TIMERIF_PERIOD4                                       0xFFFFu
+//#define TIMERIF_CLOCK_DIVISION4                               TIM_CKD_DIV1
+
+/****************************************************************
+ * Capture 0 (TIM1 CH1 on PA8, needs channel 4 for itself). The DMA requests
+ * of the capture timers share DMA1_Channel2 ... 5 with SPI1 and SPI2, so
+ * the capture interrupt stores the samples.
+ ***************************************************************/
+
+//#define TIMERIF_CAPTURE_CHANNEL0                              4u
+//#define TIMERIF_CAPTURE_PIN0                                  GpioIf_ChannelA08
+//#define TIMERIF_CAPTURE_ALTERNATE_FUNC0                       GPIO_AF_2
+//#define TIMERIF_CAPTURE_FILTER0                               0u
+//#define TIMERIF_CAPTURE_DMA_CHANNEL0                          NULL_PTR
+//#define TIMERIF_CAPTURE_NUMBER_OF_SAMPLES0                    8u
 
 #endif
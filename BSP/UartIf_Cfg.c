@@ -19,6 +19,7 @@
 #include "stm32f0xx_rcc.h"
 
 #include "Rs485.h"
+#include "Services/Scheduler_Cfg.h"
 
 /****************************************************************
  * Type definitions
@@ -22,7 +22,7 @@
 #define UARTIF_BUFFER_RD_SIZE0        255u
 #define UARTIF_BUFFER_WR_SIZE0        255u
 #define UARTIF_UART_CHANNEL_NUMBER0   1u
-#define UARTIF_RX_NOTIFIER0           NULL_PTR
+#define UARTIF_RX_NOTIFIER0           Scheduler_UartRxNotification
 #define UARTIF_TX_DRE_NOTIFIER0       NULL_PTR
 #define UARTIF_TX_COMPLETE_NOTIFIER0  NULL_PTR
 #define UARTIF_BAUD0                  115200u
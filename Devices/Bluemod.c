@@ -136,6 +136,18 @@ static void Bluemod_EnqueueSingleCmd(const uint8_t deviceNumber,
 
 static void Bluemod_DequeueCmd(const uint8_t deviceNumber);
 
+/**
+ * calls the notifier if the main function has to be called again at once
+ */
+static void Bluemod_Notify(void);
+
+/**
+ * starts the one-shot timer, which notifies at the end of the given timeout
+ * measured from the stopwatch
+ */
+static void Bluemod_StartWakeTimer(const uint8_t deviceNumber,
+                                   const uint32_t timeout);
+
 static void Bluemod_ClearLastFrame(const uint8_t deviceNumber);
 
 static void Bluemod_DataReceivedAt(const uint8_t deviceNumber,
@@ -311,6 +323,7 @@ void Bluemod_MainFunction(void)
 {
   /* local variables */
   uint8_t deviceNumber = 0;
+  Bluemod_DeviceConfigType* device;
 
   /* check config */
   if (Bluemod_userConifg != NULL_PTR)
@@ -318,9 +331,37 @@ void Bluemod_MainFunction(void)
     /* iterate through all devices */
     for (; deviceNumber < Bluemod_userConifg->numberOfDevices; deviceNumber++)
     {
+      device = &Bluemod_userConifg->deviceConfigs[deviceNumber];
+
       /* execute main according to device state */
-      Blumod_MainLookup[Bluemod_userConifg->deviceConfigs[deviceNumber].state](
-        deviceNumber);
+      Blumod_MainLookup[device->state](deviceNumber);
+
+      /* waiting for the boot or a response, wake up at the timeout */
+      if (device->state == Bluemod_StateBoot)
+      {
+        Bluemod_StartWakeTimer(deviceNumber, device->bootTime);
+      }
+      else if ((device->state != Bluemod_StateUninitialised)
+        && (device->sendRecvState == Bluemod_SendReceievStateReceiving))
+      {
+        Bluemod_StartWakeTimer(deviceNumber, device->sendTimeout);
+      }
+      else
+      {
+        /* not waiting anymore (e.g. the response arrived) */
+        if (device->wakeTimer != SYSTIMERIF_INVALID_HANDLE)
+        {
+          (void) SysTimerIf_Cancel(device->wakeTimer);
+          device->wakeTimer = SYSTIMERIF_INVALID_HANDLE;
+        }
+
+        /* next command to send or state change, do not wait */
+        if ((device->state == Bluemod_StateUninitialised)
+          || (device->sendRecvState == Bluemod_SendReceievStateSending))
+        {
+          Bluemod_Notify();
+        }
+      }
     }
   }
 }
@@ -423,8 +464,9 @@ static void Bluemod_MainUninitialized(const uint8_t deviceNumber)
   /* set bluetooth state */
   SysState_SetState(device->sysStateChannel, SysState_StateInitializing);
 
-  /* reset bluemod via reset gpio */
+  /* reset bluemod via reset gpio, the boot time starts */
   GpioIf_ClrBit(device->bluemodResetPin);
+  device->watch = Stopwatch_GetCurrentValue();
 
   /* enqueue initial commands */
   Bluemod_EnqueueRetryCmd(deviceNumber, Bluemod_CmdGetOK, Bluemod_CmdDataEmpty);
@@ -962,6 +1004,9 @@ static void Bluemod_EnqueueRetryCmd(const uint8_t deviceNumber,
 
     /* set send state */
     device->sendRecvState = Bluemod_SendReceievStateSending;
+
+    /* send the command without waiting for the timer */
+    Bluemod_Notify();
   }
 }
 
@@ -997,6 +1042,9 @@ static void Bluemod_EnqueueSingleCmd(const uint8_t deviceNumber,
 
     /* set send state */
     device->sendRecvState = Bluemod_SendReceievStateSending;
+
+    /* send the command without waiting for the timer */
+    Bluemod_Notify();
   }
 }
 
@@ -1052,3 +1100,36 @@ static void Bluemod_DequeueCmd(const uint8_t deviceNumber)
       queue->readIdx = 0u;
   }
 }
+
+static void Bluemod_Notify(void)
+{
+  /* check if a notifier is configured */
+  if (Bluemod_userConifg->notifier != NULL_PTR)
+    Bluemod_userConifg->notifier();
+}
+
+static void Bluemod_StartWakeTimer(const uint8_t deviceNumber,
+                                   const uint32_t timeout)
+{
+  /* local variables */
+  Bluemod_DeviceConfigType* device =
+    &Bluemod_userConifg->deviceConfigs[deviceNumber];
+  uint32_t elapsed =
+    Stopwatch_ReturnDifference(device->watch, Stopwatch_GetCurrentValue());
+
+  /* a cyclic main function needs no wake up, a running timer wakes it */
+  if ((Bluemod_userConifg->notifier != NULL_PTR)
+    && !SysTimerIf_IsValid(device->wakeTimer))
+  {
+    /* the timeouts expire after more than the given time */
+    if (elapsed <= timeout)
+      device->wakeTimer = SysTimerIf_Create(Bluemod_userConifg->notifier,
+        timeout - elapsed + 1u, 0u);
+    else
+      device->wakeTimer = SYSTIMERIF_INVALID_HANDLE;
+
+    /* expired or timer pool empty, call the main function again */
+    if (device->wakeTimer == SYSTIMERIF_INVALID_HANDLE)
+      Bluemod_Notify();
+  }
+}
@@ -17,6 +17,7 @@
 #include "BSP/GpioIf.h"
 #include "Services/StdDef.h"
 #include "Protocols/Ascii.h"
+#include "Services/SysTimerIf.h"
 
 
 /****************************************************************
@@ -211,6 +212,11 @@ typedef struct
  */
 typedef void (*Bluemod_NotificationType)(uint8_t const deviceNumber);
 
+/**
+ * Notification type, called if the main function has work to do
+ */
+typedef void (*Bluemod_NotifyType)(void);
+
 /**
  * Notification type for callbacks with given channel
  */
@@ -327,6 +333,12 @@ typedef struct
    * stopwatch for sending timeout and booting time
    */
   uint32_t watch;
+
+  /**
+   * one-shot timer, which notifies at the end of the sending timeout or
+   * booting time
+   */
+  SysTimerIf_HandleType wakeTimer;
   
   /**
    * timeout for waiting on the response of an command, before resending it
@@ -365,6 +377,13 @@ typedef struct
    * device Configurations
    */
   Bluemod_DeviceConfigType* deviceConfigs;
+
+  /**
+   * Optional notification on queued commands and the end of the sending
+   * timeout and booting time (SysTimerIf pool timer), NULL_PTR if the main
+   * function is called cyclically
+   */
+  const Bluemod_NotifyType notifier;
   
 } Bluemod_ConfigType;
 
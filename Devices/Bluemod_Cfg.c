@@ -19,6 +19,7 @@
 #include "Protocols/BtDevM.h"
 #include "Protocols/TbProt.h"
 #include "BSP/GpioIf.h"
+#include "Services/Scheduler_Cfg.h"
 
 /****************************************************************
  * Type definitions
@@ -81,6 +82,7 @@ Bluemod_DeviceConfigType Bluemod_DeviceConfigs[BLUEMOD_NUMBER_OF_DEVICES] =
     BLUEMOD_INIT_STATE,
     BLUEMOD_INIT_SEND_RECV_STATE,
     0u,
+    SYSTIMERIF_INVALID_HANDLE,
     BLUEMOD_RECEIVE_RESPONSE_TIMEOUT,
     BLUEMOD_BOOT_TIME,
     BLUEMOD_RESET_PIN,
@@ -91,7 +93,8 @@ Bluemod_DeviceConfigType Bluemod_DeviceConfigs[BLUEMOD_NUMBER_OF_DEVICES] =
 Bluemod_ConfigType Bluemod_config = 
 {
   1u,
-  Bluemod_DeviceConfigs
+  Bluemod_DeviceConfigs,
+  BLUEMOD_NOTIFIER
 };
 
 /****************************************************************
@@ -16,6 +16,7 @@
 
 /* Generic */
 #define BLUEMOD_NUMBER_OF_DEVICES               1u
+#define BLUEMOD_NOTIFIER                        Scheduler_BluemodNotification
 
 /* Device 0 */
 #define BLUEMOD_HAL_CHANNEL                     0u
@@ -0,0 +1,662 @@
+/**
+ ******************************************************************************
+ * @file    SpiFlash.c
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Driver for serial NOR flash devices (JEDEC command set) on SpiIf.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#include "Devices/SpiFlash.h"
+#include "Services/Stopwatch.h"
+#include "Services/SysTimerIf.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/**
+ * function type for the state dependent main functions
+ * @param deviceNumber
+ */
+typedef void (*SpiFlash_MainFunctionType)(const uint8_t deviceNumber);
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+/* JEDEC commands */
+#define SPIFLASH_CMD_READ_ID              0x9Fu
+#define SPIFLASH_CMD_READ                 0x03u
+#define SPIFLASH_CMD_FAST_READ            0x0Bu
+#define SPIFLASH_CMD_WRITE_ENABLE         0x06u
+#define SPIFLASH_CMD_PAGE_PROGRAM         0x02u
+#define SPIFLASH_CMD_SECTOR_ERASE         0x20u
+#define SPIFLASH_CMD_READ_STATUS          0x05u
+
+/* Status register: write in progress */
+#define SPIFLASH_STATUS_WIP               0x01u
+
+/* Command with 24 bit address */
+#define SPIFLASH_ADDRESS_CMD_LENGTH       4u
+
+/****************************************************************
+ * Function declarations
+ ***************************************************************/
+
+static void SpiFlash_MainUninitialised(const uint8_t deviceNumber);
+static void SpiFlash_MainProbing(const uint8_t deviceNumber);
+static void SpiFlash_MainIdle(const uint8_t deviceNumber);
+static void SpiFlash_MainTransfer(const uint8_t deviceNumber);
+static void SpiFlash_MainPolling(const uint8_t deviceNumber);
+static void SpiFlash_MainDelay(const uint8_t deviceNumber);
+static void SpiFlash_MainError(const uint8_t deviceNumber);
+
+static void SpiFlash_StartChunk(const uint8_t deviceNumber);
+static void SpiFlash_StartPolling(const uint8_t deviceNumber);
+static void SpiFlash_EnterError(const uint8_t deviceNumber);
+static void SpiFlash_CompleteRequest(const uint8_t deviceNumber,
+  const SpiFlash_RequestStateType state);
+static BOOL SpiFlash_IsTransactionDone(const uint8_t deviceNumber);
+static void SpiFlash_SetupJob(const SpiFlash_DeviceConfigType* device,
+  SpiIf_JobType* job, const SpiIf_DataType* txData, SpiIf_LengthType txLength,
+  SpiIf_DataType* rxData, SpiIf_LengthType rxLength, SpiIf_JobType* next);
+static void SpiFlash_SetupCommand(SpiFlash_RuntimeType* runtime, uint8_t command,
+  SpiFlash_AddressType address);
+static void SpiFlash_JobCompletion(SpiIf_JobType* job);
+static void SpiFlash_Notify(void);
+static void SpiFlash_StartWakeTimer(const uint8_t deviceNumber, const uint32_t start,
+  const uint32_t interval);
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+static SpiFlash_ConfigType* SpiFlash_userCfg = NULL_PTR;
+
+static const SpiFlash_MainFunctionType SpiFlash_mainLookup[] =
+{
+  SpiFlash_MainUninitialised,
+  SpiFlash_MainProbing,
+  SpiFlash_MainIdle,
+  SpiFlash_MainTransfer,
+  SpiFlash_MainPolling,
+  SpiFlash_MainDelay,
+  SpiFlash_MainError
+};
+
+static const SpiIf_DataType SpiFlash_cmdReadId[] =
+{
+  SPIFLASH_CMD_READ_ID
+};
+
+static const SpiIf_DataType SpiFlash_cmdWriteEnable[] =
+{
+  SPIFLASH_CMD_WRITE_ENABLE
+};
+
+static const SpiIf_DataType SpiFlash_cmdReadStatus[] =
+{
+  SPIFLASH_CMD_READ_STATUS
+};
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+void SpiFlash_Init(SpiFlash_ConfigType* config)
+{
+  /* Local variables */
+  uint8_t deviceNumber;
+
+  /* Initialize local variables */
+  deviceNumber = 0u;
+
+  /* Check user configuration and parameters */
+  if ((SpiFlash_userCfg == NULL_PTR) && (config != NULL_PTR))
+  {
+    /* Store given configuration locally */
+    SpiFlash_userCfg = config;
+
+    /* Devices are probed by the main function */
+    for (deviceNumber = 0u; deviceNumber < config->numberOfDevices; deviceNumber++)
+    {
+      config->deviceConfigs[deviceNumber].runtime->state = SpiFlash_StateUninitialised;
+      config->deviceConfigs[deviceNumber].runtime->wakeTimer = SYSTIMERIF_INVALID_HANDLE;
+    }
+  }
+}
+
+void SpiFlash_MainFunction(void)
+{
+  /* Local variables */
+  uint8_t deviceNumber;
+  const SpiFlash_DeviceConfigType* device;
+
+  /* Initialize local variables */
+  deviceNumber = 0u;
+
+  /* Check user configuration */
+  if (SpiFlash_userCfg != NULL_PTR)
+  {
+    /* Execute main according to device state */
+    for (deviceNumber = 0u; deviceNumber < SpiFlash_userCfg->numberOfDevices;
+      deviceNumber++)
+    {
+      device = &SpiFlash_userCfg->deviceConfigs[deviceNumber];
+      SpiFlash_mainLookup[device->runtime->state](deviceNumber);
+
+      /* States, which do not wait for a job: queued requests (e.g. after
+       *  probing) and the reprobe are processed at once, the delay between
+       *  status polls and the reprobe delay are woken by a timer */
+      if (((device->runtime->state == SpiFlash_StateIdle)
+          && (device->requestQueue->space < device->requestQueue->size))
+        || (device->runtime->state == SpiFlash_StateUninitialised))
+      {
+        SpiFlash_Notify();
+      }
+      else if (device->runtime->state == SpiFlash_StateDelay)
+      {
+        SpiFlash_StartWakeTimer(deviceNumber, device->runtime->pollWatch,
+          device->pollInterval);
+      }
+      else if (device->runtime->state == SpiFlash_StateError)
+      {
+        SpiFlash_StartWakeTimer(deviceNumber, device->runtime->watch,
+          device->reprobeInterval);
+      }
+    }
+  }
+}
+
+BOOL SpiFlash_Enqueue(uint8_t deviceNumber, SpiFlash_RequestType* request)
+{
+  /* Local variables */
+  BOOL ret;
+  SpiFlash_DeviceConfigType* device;
+  SpiFlash_QueueType* queue;
+
+  /* Initialize local variables */
+  ret = FALSE;
+  device = NULL_PTR;
+  queue = NULL_PTR;
+
+  /* Check user configuration and parameters */
+  if ((SpiFlash_userCfg != NULL_PTR) && (deviceNumber < SpiFlash_userCfg->numberOfDevices)
+      && (request != NULL_PTR))
+  {
+    device = &SpiFlash_userCfg->deviceConfigs[deviceNumber];
+    queue = device->requestQueue;
+
+    /* Reject requests beyond the flash or without data */
+    if ((device->runtime->state != SpiFlash_StateError)
+      && (request->address < device->size)
+      && ((request->kind == SpiFlash_RequestErase)
+        || ((request->data != NULL_PTR) && (request->length > 0u)
+          && (request->length <= device->size - request->address)))
+      && (queue->space > 0u))
+    {
+      /* Queue request and update queue variables */
+      request->state = SpiFlash_RequestQueued;
+      queue->requests[queue->wrIdx] = request;
+      queue->wrIdx = (SpiFlash_QueueLengthType) ((queue->wrIdx + 1u) % queue->size);
+      queue->space--;
+      ret = TRUE;
+
+      SpiFlash_Notify();
+    }
+  }
+
+  return ret;
+}
+
+SpiFlash_QueueLengthType SpiFlash_GetQueueSpace(uint8_t deviceNumber)
+{
+  /* Local variables */
+  SpiFlash_QueueLengthType ret;
+
+  /* Initialize local variables */
+  ret = 0u;
+
+  /* Check user configuration and parameters */
+  if ((SpiFlash_userCfg != NULL_PTR) && (deviceNumber < SpiFlash_userCfg->numberOfDevices)
+    && (SpiFlash_userCfg->deviceConfigs[deviceNumber].runtime->state != SpiFlash_StateError))
+  {
+    ret = SpiFlash_userCfg->deviceConfigs[deviceNumber].requestQueue->space;
+  }
+
+  return ret;
+}
+
+BOOL SpiFlash_IsReady(uint8_t deviceNumber)
+{
+  /* Local variables */
+  BOOL ret;
+
+  /* Initialize local variables */
+  ret = FALSE;
+
+  /* Check user configuration and parameters */
+  if ((SpiFlash_userCfg != NULL_PTR) && (deviceNumber < SpiFlash_userCfg->numberOfDevices))
+  {
+    ret = (SpiFlash_userCfg->deviceConfigs[deviceNumber].runtime->state
+      != SpiFlash_StateUninitialised)
+      && (SpiFlash_userCfg->deviceConfigs[deviceNumber].runtime->state
+        != SpiFlash_StateProbing)
+      && (SpiFlash_userCfg->deviceConfigs[deviceNumber].runtime->state
+        != SpiFlash_StateError);
+  }
+
+  return ret;
+}
+
+uint32_t SpiFlash_GetJedecId(uint8_t deviceNumber)
+{
+  /* Local variables */
+  uint32_t ret;
+
+  /* Initialize local variables */
+  ret = 0u;
+
+  /* Check user configuration and parameters */
+  if ((SpiFlash_userCfg != NULL_PTR) && (deviceNumber < SpiFlash_userCfg->numberOfDevices))
+    ret = SpiFlash_userCfg->deviceConfigs[deviceNumber].runtime->jedecId;
+
+  return ret;
+}
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+/****************************************************************
+ * Static functions
+ ***************************************************************/
+
+static void SpiFlash_MainUninitialised(const uint8_t deviceNumber)
+{
+  /* Local variables */
+  const SpiFlash_DeviceConfigType* device;
+  SpiFlash_RuntimeType* runtime;
+
+  /* Initialize local variables */
+  device = &SpiFlash_userCfg->deviceConfigs[deviceNumber];
+  runtime = device->runtime;
+
+  /* Read JEDEC ID */
+  SpiFlash_SetupJob(device, &runtime->jobs[0], SpiFlash_cmdReadId,
+    sizeof(SpiFlash_cmdReadId), runtime->response, SPIFLASH_RESPONSE_LENGTH,
+    NULL_PTR);
+  SpiIf_EnqueueJob(device->spiChannel, &runtime->jobs[0]);
+
+  runtime->state = SpiFlash_StateProbing;
+}
+
+static void SpiFlash_MainProbing(const uint8_t deviceNumber)
+{
+  /* Local variables */
+  const SpiFlash_DeviceConfigType* device;
+  SpiFlash_RuntimeType* runtime;
+
+  /* Initialize local variables */
+  device = &SpiFlash_userCfg->deviceConfigs[deviceNumber];
+  runtime = device->runtime;
+
+  if (SpiFlash_IsTransactionDone(deviceNumber))
+  {
+    runtime->jedecId = ((uint32_t) runtime->response[0] << 16)
+      | ((uint32_t) runtime->response[1] << 8) | runtime->response[2];
+
+    /* No device answers with all bits set (or cleared) */
+    if ((runtime->jedecId == 0u) || (runtime->jedecId == 0xFFFFFFu)
+      || ((device->expectedJedecId != 0u)
+        && (runtime->jedecId != device->expectedJedecId)))
+    {
+      SpiFlash_EnterError(deviceNumber);
+    }
+    else
+    {
+      runtime->state = SpiFlash_StateIdle;
+    }
+  }
+}
+
+static void SpiFlash_MainIdle(const uint8_t deviceNumber)
+{
+  /* Local variables */
+  SpiFlash_QueueType* queue;
+
+  /* Initialize local variables */
+  queue = SpiFlash_userCfg->deviceConfigs[deviceNumber].requestQueue;
+
+  /* Start the next request */
+  if (queue->space < queue->size)
+  {
+    queue->requests[queue->rdIdx]->state = SpiFlash_RequestBusy;
+    SpiFlash_userCfg->deviceConfigs[deviceNumber].runtime->offset = 0u;
+    SpiFlash_StartChunk(deviceNumber);
+  }
+}
+
+static void SpiFlash_MainTransfer(const uint8_t deviceNumber)
+{
+  /* Local variables */
+  const SpiFlash_DeviceConfigType* device;
+  SpiFlash_RequestType* request;
+
+  /* Initialize local variables */
+  device = &SpiFlash_userCfg->deviceConfigs[deviceNumber];
+  request = device->requestQueue->requests[device->requestQueue->rdIdx];
+
+  if (SpiFlash_IsTransactionDone(deviceNumber))
+  {
+    if (request->kind == SpiFlash_RequestRead)
+    {
+      /* Reads are complete with the transfer */
+      SpiFlash_CompleteRequest(deviceNumber, SpiFlash_RequestDone);
+    }
+    else
+    {
+      /* Program and erase continue in the flash */
+      device->runtime->watch = Stopwatch_GetCurrentValue();
+      SpiFlash_StartPolling(deviceNumber);
+    }
+  }
+}
+
+static void SpiFlash_MainPolling(const uint8_t deviceNumber)
+{
+  /* Local variables */
+  const SpiFlash_DeviceConfigType* device;
+  SpiFlash_RuntimeType* runtime;
+  SpiFlash_RequestType* request;
+
+  /* Initialize local variables */
+  device = &SpiFlash_userCfg->deviceConfigs[deviceNumber];
+  runtime = device->runtime;
+  request = device->requestQueue->requests[device->requestQueue->rdIdx];
+
+  if (SpiFlash_IsTransactionDone(deviceNumber))
+  {
+    if ((runtime->response[0] & SPIFLASH_STATUS_WIP) == 0u)
+    {
+      /* Chunk finished, continue with the next page or request right away */
+      runtime->offset = (SpiFlash_LengthType) (runtime->offset + runtime->chunk);
+
+      if ((request->kind == SpiFlash_RequestProgram) && (runtime->offset < request->length))
+      {
+        SpiFlash_StartChunk(deviceNumber);
+      }
+      else
+      {
+        SpiFlash_CompleteRequest(deviceNumber, SpiFlash_RequestDone);
+        SpiFlash_MainIdle(deviceNumber);
+      }
+    }
+    else if (Stopwatch_ReturnDifference(runtime->watch, Stopwatch_GetCurrentValue())
+      > device->busyTimeout)
+    {
+      /* The flash hangs, probe it again before the next request */
+      SpiFlash_EnterError(deviceNumber);
+      SpiFlash_CompleteRequest(deviceNumber, SpiFlash_RequestFailed);
+    }
+    else
+    {
+      /* Still busy, poll again after the poll interval */
+      runtime->pollWatch = Stopwatch_GetCurrentValue();
+      runtime->state = SpiFlash_StateDelay;
+    }
+  }
+}
+
+static void SpiFlash_MainDelay(const uint8_t deviceNumber)
+{
+  /* Local variables */
+  const SpiFlash_DeviceConfigType* device;
+
+  /* Initialize local variables */
+  device = &SpiFlash_userCfg->deviceConfigs[deviceNumber];
+
+  if (Stopwatch_ReturnDifference(device->runtime->pollWatch, Stopwatch_GetCurrentValue())
+    >= device->pollInterval)
+  {
+    SpiFlash_StartPolling(deviceNumber);
+  }
+}
+
+static void SpiFlash_MainError(const uint8_t deviceNumber)
+{
+  /* Local variables */
+  const SpiFlash_DeviceConfigType* device;
+  SpiFlash_QueueType* queue;
+
+  /* Initialize local variables */
+  device = &SpiFlash_userCfg->deviceConfigs[deviceNumber];
+  queue = device->requestQueue;
+
+  /* Fail all requests queued before the device failed */
+  while (queue->space < queue->size)
+    SpiFlash_CompleteRequest(deviceNumber, SpiFlash_RequestFailed);
+
+  /* Probe again (e.g. flash connected late or recovered after a hang) */
+  if (Stopwatch_ReturnDifference(device->runtime->watch, Stopwatch_GetCurrentValue())
+    >= device->reprobeInterval)
+  {
+    device->runtime->state = SpiFlash_StateUninitialised;
+  }
+}
+
+static void SpiFlash_StartChunk(const uint8_t deviceNumber)
+{
+  /* Local variables */
+  const SpiFlash_DeviceConfigType* device;
+  SpiFlash_RuntimeType* runtime;
+  SpiFlash_RequestType* request;
+  SpiFlash_AddressType address;
+  SpiFlash_AddressType pageSpace;
+
+  /* Initialize local variables */
+  device = &SpiFlash_userCfg->deviceConfigs[deviceNumber];
+  runtime = device->runtime;
+  request = device->requestQueue->requests[device->requestQueue->rdIdx];
+  address = request->address + runtime->offset;
+  pageSpace = 0u;
+
+  switch (request->kind)
+  {
+    case SpiFlash_RequestRead:
+      /* Command and address, followed by the data under the same CS */
+      runtime->chunk = request->length;
+      SpiFlash_SetupCommand(runtime,
+        device->fastRead ? SPIFLASH_CMD_FAST_READ : SPIFLASH_CMD_READ, address);
+      SpiFlash_SetupJob(device, &runtime->jobs[0], runtime->command,
+        device->fastRead ? SPIFLASH_COMMAND_LENGTH : SPIFLASH_ADDRESS_CMD_LENGTH,
+        NULL_PTR, 0u, &runtime->jobs[1]);
+      SpiFlash_SetupJob(device, &runtime->jobs[1], NULL_PTR, 0u, request->data,
+        runtime->chunk, NULL_PTR);
+      runtime->jobs[0].keepCs = TRUE;
+      break;
+
+    case SpiFlash_RequestProgram:
+      /* Page program must not cross the page boundary */
+      pageSpace = device->pageSize - (address % device->pageSize);
+      runtime->chunk = (SpiFlash_LengthType) (request->length - runtime->offset);
+      if (runtime->chunk > pageSpace)
+        runtime->chunk = (SpiFlash_LengthType) pageSpace;
+
+      /* Write enable (own CS cycle), command and address, data */
+      SpiFlash_SetupCommand(runtime, SPIFLASH_CMD_PAGE_PROGRAM, address);
+      SpiFlash_SetupJob(device, &runtime->jobs[0], SpiFlash_cmdWriteEnable,
+        sizeof(SpiFlash_cmdWriteEnable), NULL_PTR, 0u, &runtime->jobs[1]);
+      SpiFlash_SetupJob(device, &runtime->jobs[1], runtime->command,
+        SPIFLASH_ADDRESS_CMD_LENGTH, NULL_PTR, 0u, &runtime->jobs[2]);
+      SpiFlash_SetupJob(device, &runtime->jobs[2], &request->data[runtime->offset],
+        runtime->chunk, NULL_PTR, 0u, NULL_PTR);
+      runtime->jobs[1].keepCs = TRUE;
+      break;
+
+    case SpiFlash_RequestErase:
+    default:
+      /* Write enable (own CS cycle), command and sector address */
+      runtime->chunk = 0u;
+      SpiFlash_SetupCommand(runtime, SPIFLASH_CMD_SECTOR_ERASE,
+        address - (address % device->sectorSize));
+      SpiFlash_SetupJob(device, &runtime->jobs[0], SpiFlash_cmdWriteEnable,
+        sizeof(SpiFlash_cmdWriteEnable), NULL_PTR, 0u, &runtime->jobs[1]);
+      SpiFlash_SetupJob(device, &runtime->jobs[1], runtime->command,
+        SPIFLASH_ADDRESS_CMD_LENGTH, NULL_PTR, 0u, NULL_PTR);
+      break;
+  }
+
+  SpiIf_EnqueueJob(device->spiChannel, &runtime->jobs[0]);
+  runtime->state = SpiFlash_StateTransfer;
+}
+
+static void SpiFlash_StartPolling(const uint8_t deviceNumber)
+{
+  /* Local variables */
+  const SpiFlash_DeviceConfigType* device;
+  SpiFlash_RuntimeType* runtime;
+
+  /* Initialize local variables */
+  device = &SpiFlash_userCfg->deviceConfigs[deviceNumber];
+  runtime = device->runtime;
+
+  /* Read status register */
+  SpiFlash_SetupJob(device, &runtime->jobs[0], SpiFlash_cmdReadStatus,
+    sizeof(SpiFlash_cmdReadStatus), runtime->response, 1u, NULL_PTR);
+  SpiIf_EnqueueJob(device->spiChannel, &runtime->jobs[0]);
+
+  runtime->state = SpiFlash_StatePolling;
+}
+
+static void SpiFlash_EnterError(const uint8_t deviceNumber)
+{
+  /* Local variables */
+  SpiFlash_RuntimeType* runtime;
+
+  /* Initialize local variables */
+  runtime = SpiFlash_userCfg->deviceConfigs[deviceNumber].runtime;
+
+  /* Requests are rejected until the device was probed again */
+  runtime->watch = Stopwatch_GetCurrentValue();
+  runtime->state = SpiFlash_StateError;
+}
+
+static void SpiFlash_CompleteRequest(const uint8_t deviceNumber,
+  const SpiFlash_RequestStateType state)
+{
+  /* Local variables */
+  SpiFlash_DeviceConfigType* device;
+  SpiFlash_QueueType* queue;
+
+  /* Initialize local variables */
+  device = &SpiFlash_userCfg->deviceConfigs[deviceNumber];
+  queue = device->requestQueue;
+
+  /* Report result and remove request from the queue */
+  queue->requests[queue->rdIdx]->state = state;
+  queue->rdIdx = (SpiFlash_QueueLengthType) ((queue->rdIdx + 1u) % queue->size);
+  queue->space++;
+
+  if (device->runtime->state != SpiFlash_StateError)
+    device->runtime->state = SpiFlash_StateIdle;
+}
+
+static BOOL SpiFlash_IsTransactionDone(const uint8_t deviceNumber)
+{
+  /* Local variables */
+  const SpiFlash_DeviceConfigType* device;
+  SpiFlash_RuntimeType* runtime;
+
+  /* Initialize local variables */
+  device = &SpiFlash_userCfg->deviceConfigs[deviceNumber];
+  runtime = device->runtime;
+
+  /* SpiIf did not accept the transaction (e.g. queue full), try again */
+  if ((runtime->jobs[0].state == SpiIf_JobUnprocessed)
+    || (runtime->jobs[0].state == SpiIf_JobReverted))
+    SpiIf_EnqueueJob(device->spiChannel, &runtime->jobs[0]);
+
+  return SpiIf_IsJobProcessed(&runtime->jobs[0]);
+}
+
+static void SpiFlash_SetupJob(const SpiFlash_DeviceConfigType* device,
+  SpiIf_JobType* job, const SpiIf_DataType* txData, SpiIf_LengthType txLength,
+  SpiIf_DataType* rxData, SpiIf_LengthType rxLength, SpiIf_JobType* next)
+{
+  /* Responses follow the transmitted command */
+  job->device = device->spiDevice;
+  job->priority = device->spiPriority;
+  job->transmittBuffer = txData;
+  job->transmittLength = txLength;
+  job->receiveBuffer = rxData;
+  job->receiveLength = rxLength;
+  job->receiveBegin = txLength;
+  job->rxNotifier = NULL_PTR;
+  job->completion = SpiFlash_JobCompletion;
+  job->next = next;
+  job->keepCs = FALSE;
+  job->state = SpiIf_JobUnprocessed;
+}
+
+static void SpiFlash_SetupCommand(SpiFlash_RuntimeType* runtime, uint8_t command,
+  SpiFlash_AddressType address)
+{
+  /* Command, 24 bit address (MSB first) and dummy byte for fast read */
+  runtime->command[0] = command;
+  runtime->command[1] = (SpiIf_DataType) (address >> 16);
+  runtime->command[2] = (SpiIf_DataType) (address >> 8);
+  runtime->command[3] = (SpiIf_DataType) address;
+  runtime->command[4] = 0u;
+}
+
+static void SpiFlash_JobCompletion(SpiIf_JobType* job)
+{
+  (void) job;
+  SpiFlash_Notify();
+}
+
+static void SpiFlash_Notify(void)
+{
+  if (SpiFlash_userCfg->notifier != NULL_PTR)
+  {
+    SpiFlash_userCfg->notifier();
+  }
+}
+
+static void SpiFlash_StartWakeTimer(const uint8_t deviceNumber, const uint32_t start,
+  const uint32_t interval)
+{
+  /* Local variables */
+  SpiFlash_RuntimeType* runtime;
+  uint32_t elapsed;
+
+  /* Initialize local variables */
+  runtime = SpiFlash_userCfg->deviceConfigs[deviceNumber].runtime;
+  elapsed = Stopwatch_ReturnDifference(start, Stopwatch_GetCurrentValue());
+
+  /* A cyclic main function needs no wake up, a running timer wakes it already */
+  if ((SpiFlash_userCfg->notifier != NULL_PTR) && !SysTimerIf_IsValid(runtime->wakeTimer))
+  {
+    if (elapsed < interval)
+    {
+      runtime->wakeTimer = SysTimerIf_Create(SpiFlash_userCfg->notifier,
+        interval - elapsed, 0u);
+    }
+    else
+    {
+      runtime->wakeTimer = SYSTIMERIF_INVALID_HANDLE;
+    }
+
+    /* Expired or timer pool empty, fall back to calling the main function again */
+    if (runtime->wakeTimer == SYSTIMERIF_INVALID_HANDLE)
+    {
+      SpiFlash_Notify();
+    }
+  }
+}
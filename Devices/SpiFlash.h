@@ -0,0 +1,246 @@
+/**
+ ******************************************************************************
+ * @file    SpiFlash.h
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Driver for serial NOR flash devices (JEDEC command set) on SpiIf.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#ifndef SPIFLASH_H
+#define SPIFLASH_H
+
+#include "Services/StdDef.h"
+#include "BSP/SpiIf.h"
+#include "Services/SysTimerIf.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/* Sizes of the internal job and command buffers */
+#define SPIFLASH_NUMBER_OF_JOBS           3u
+#define SPIFLASH_COMMAND_LENGTH           5u
+#define SPIFLASH_RESPONSE_LENGTH          3u
+
+typedef uint32_t SpiFlash_AddressType;
+
+/**
+ * Notification, called if the main function has work to do. May be
+ *  interrupt driven.
+ */
+typedef void (*SpiFlash_NotifyType)(void);
+typedef SpiIf_LengthType SpiFlash_LengthType;
+
+/**
+ * Request types.
+ */
+typedef enum
+{
+  SpiFlash_RequestRead = 0u,
+  SpiFlash_RequestProgram,
+  SpiFlash_RequestErase
+} SpiFlash_RequestKindType;
+
+/**
+ * Request states, polled by the owner of the request.
+ */
+typedef enum
+{
+  SpiFlash_RequestIdle = 0u,
+  SpiFlash_RequestQueued,
+  SpiFlash_RequestBusy,
+  SpiFlash_RequestDone,
+  SpiFlash_RequestFailed
+} SpiFlash_RequestStateType;
+
+/**
+ * Flash request. The request (and its data) is owned by the caller and
+ *  has to stay valid until its state is done or failed.
+ */
+typedef struct
+{
+  SpiFlash_RequestKindType kind;
+  /**
+   * Start address; erase requests erase the sector containing it.
+   */
+  SpiFlash_AddressType address;
+  /**
+   * Destination (read) or source (program) data, unused for erase.
+   */
+  uint8_t* data;
+  SpiFlash_LengthType length;
+  SpiFlash_RequestStateType state;
+} SpiFlash_RequestType;
+
+typedef uint8_t SpiFlash_QueueLengthType;
+
+/**
+ * Queue of pending requests.
+ */
+typedef struct
+{
+  SpiFlash_RequestType** const requests;
+  SpiFlash_QueueLengthType rdIdx;
+  SpiFlash_QueueLengthType wrIdx;
+  SpiFlash_QueueLengthType space;
+  const SpiFlash_QueueLengthType size;
+} SpiFlash_QueueType;
+
+/**
+ * Device states.
+ */
+typedef enum
+{
+  SpiFlash_StateUninitialised = 0u,
+  SpiFlash_StateProbing,
+  SpiFlash_StateIdle,
+  SpiFlash_StateTransfer,
+  SpiFlash_StatePolling,
+  SpiFlash_StateDelay,
+  SpiFlash_StateError
+} SpiFlash_StateType;
+
+/**
+ * Runtime data of one device.
+ */
+typedef struct
+{
+  SpiFlash_StateType state;
+  SpiIf_JobType jobs[SPIFLASH_NUMBER_OF_JOBS];
+  SpiIf_DataType command[SPIFLASH_COMMAND_LENGTH];
+  SpiIf_DataType response[SPIFLASH_RESPONSE_LENGTH];
+  /**
+   * Progress within the current request and size of the current chunk.
+   */
+  SpiFlash_LengthType offset;
+  SpiFlash_LengthType chunk;
+  /**
+   * Start of the program/erase (or of the error state) and of the delay
+   *  before the next status poll.
+   */
+  uint32_t watch;
+  uint32_t pollWatch;
+  /**
+   * One-shot timer, which notifies at the end of the poll or reprobe delay.
+   */
+  SysTimerIf_HandleType wakeTimer;
+  uint32_t jedecId;
+} SpiFlash_RuntimeType;
+
+/**
+ * Device configuration.
+ */
+typedef struct
+{
+  const uint8_t spiChannel;
+  const SpiIf_DeviceConfigType* spiDevice;
+  const uint8_t spiPriority;
+  /**
+   * Expected JEDEC ID (manufacturer, type, capacity), 0 accepts any device.
+   */
+  const uint32_t expectedJedecId;
+  const SpiFlash_AddressType size;
+  const SpiFlash_AddressType sectorSize;
+  const SpiFlash_LengthType pageSize;
+  /**
+   * Use fast read (with dummy byte), required for higher SPI clocks.
+   */
+  const BOOL fastRead;
+  /**
+   * Maximum program/erase time in ms, before a request fails and the device
+   *  is probed again.
+   */
+  const uint32_t busyTimeout;
+  /**
+   * Time in ms between two status polls while the flash is busy.
+   */
+  const uint32_t pollInterval;
+  /**
+   * Time in ms in the error state (requests are rejected), before the
+   *  device is probed again.
+   */
+  const uint32_t reprobeInterval;
+  SpiFlash_QueueType* const requestQueue;
+  SpiFlash_RuntimeType* const runtime;
+} SpiFlash_DeviceConfigType;
+
+typedef struct
+{
+  const uint8_t numberOfDevices;
+  SpiFlash_DeviceConfigType* deviceConfigs;
+  /**
+   * Optional notification on enqueued requests, finished SpiIf jobs and the
+   *  end of poll and reprobe delays (SysTimerIf pool timer), NULL_PTR if the
+   *  main function is called cyclically.
+   */
+  const SpiFlash_NotifyType notifier;
+} SpiFlash_ConfigType;
+
+/****************************************************************
+ * Macros                                                       *
+ ***************************************************************/
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+extern SpiFlash_ConfigType SpiFlash_config;
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+/**
+ * Initialize the flash driver. The devices are probed by the main function.
+ * @param config Pointer to the configuration.
+ */
+void SpiFlash_Init(SpiFlash_ConfigType* config);
+
+/**
+ * Processes the request queues, has to be called cyclically. Never waits
+ *  for the flash; program and erase are polled across calls.
+ */
+void SpiFlash_MainFunction(void);
+
+/**
+ * Queues a request. Further requests may be queued while the previous
+ *  ones are in progress (e.g. the next page while one is programming).
+ *  Not interrupt safe, call from the main loop only.
+ * @param deviceNumber The flash device.
+ * @param request The request, its state is updated by the driver.
+ * @return TRUE if the request was queued; otherwise FALSE.
+ */
+BOOL SpiFlash_Enqueue(uint8_t deviceNumber, SpiFlash_RequestType* request);
+
+/**
+ * Gets the number of requests, which may be queued at once.
+ * @param deviceNumber The flash device.
+ * @return The free entries of the request queue, 0 if requests are rejected.
+ */
+SpiFlash_QueueLengthType SpiFlash_GetQueueSpace(uint8_t deviceNumber);
+
+/**
+ * Checks if the device was probed successfully. A failed device (probing
+ *  or busy timeout) is probed again after the reprobe interval.
+ * @param deviceNumber The flash device.
+ * @return TRUE if the device accepts requests; otherwise FALSE.
+ */
+BOOL SpiFlash_IsReady(uint8_t deviceNumber);
+
+/**
+ * Gets the JEDEC ID read during probing.
+ * @param deviceNumber The flash device.
+ * @return The JEDEC ID, 0 if not probed yet.
+ */
+uint32_t SpiFlash_GetJedecId(uint8_t deviceNumber);
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ ******************************************************************************
+ * @file    SpiFlash_Cfg.c
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Configuration of the serial NOR flash driver.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#include "Devices/SpiFlash.h"
+#include "Devices/SpiFlash_Cfg.h"
+
+/* notifications */
+#include "Services/Scheduler_Cfg.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+/****************************************************************
+ * Function declarations
+ ***************************************************************/
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+static SpiFlash_RequestType* SpiFlash_requests0[SPIFLASH_REQUEST_QUEUE_SIZE0];
+static SpiFlash_QueueType SpiFlash_queue0 =
+{
+  SpiFlash_requests0,
+  0u,
+  0u,
+  SPIFLASH_REQUEST_QUEUE_SIZE0,
+  SPIFLASH_REQUEST_QUEUE_SIZE0
+};
+
+static SpiFlash_RuntimeType SpiFlash_runtime0;
+
+static SpiFlash_DeviceConfigType SpiFlash_devices[SPIFLASH_NUMBER_OF_DEVICES] =
+{
+  {
+    SPIFLASH_SPI_CHANNEL0,
+    &SpiIf_devices[SPIFLASH_SPI_DEVICE0],
+    SPIFLASH_SPI_PRIORITY0,
+    SPIFLASH_JEDEC_ID0,
+    SPIFLASH_SIZE0,
+    SPIFLASH_SECTOR_SIZE0,
+    SPIFLASH_PAGE_SIZE0,
+    SPIFLASH_FAST_READ0,
+    SPIFLASH_BUSY_TIMEOUT0,
+    SPIFLASH_POLL_INTERVAL0,
+    SPIFLASH_REPROBE_INTERVAL0,
+    &SpiFlash_queue0,
+    &SpiFlash_runtime0
+  }
+};
+
+SpiFlash_ConfigType SpiFlash_config =
+{
+  SPIFLASH_NUMBER_OF_DEVICES,
+  SpiFlash_devices,
+  SPIFLASH_NOTIFIER
+};
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+/****************************************************************
+ * Static functions
+ ***************************************************************/
@@ -0,0 +1,37 @@
+/**
+ ******************************************************************************
+ * @file    SpiFlash_Cfg.h
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Configuration of the serial NOR flash driver.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#ifndef SPIFLASH_CFG_H
+#define SPIFLASH_CFG_H
+
+#include "Services/StdDef.h"
+
+/* Generic */
+#define SPIFLASH_NUMBER_OF_DEVICES        1u
+#define SPIFLASH_NOTIFIER                 Scheduler_SpiFlashNotification
+
+/* Device 0 (W25Q16, 2 MByte) */
+#define SPIFLASH_SPI_CHANNEL0             0u
+#define SPIFLASH_SPI_DEVICE0              0u
+#define SPIFLASH_SPI_PRIORITY0            0u
+#define SPIFLASH_JEDEC_ID0                0xEF4015u
+#define SPIFLASH_SIZE0                    0x200000u
+#define SPIFLASH_SECTOR_SIZE0             4096u
+#define SPIFLASH_PAGE_SIZE0               256u
+#define SPIFLASH_FAST_READ0               TRUE
+#define SPIFLASH_BUSY_TIMEOUT0            500u
+#define SPIFLASH_POLL_INTERVAL0           1u
+#define SPIFLASH_REPROBE_INTERVAL0        1000u
+#define SPIFLASH_REQUEST_QUEUE_SIZE0      4u
+
+#endif
@@ -0,0 +1,105 @@
+/**
+ ******************************************************************************
+ * @file    Coroutine.c
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Stackless coroutines (protothreads) for driver state machines.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#include "Coroutine.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+/****************************************************************
+ * Function declarations
+ ***************************************************************/
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+void Coroutine_Reset(Coroutine_ContextType* ctx)
+{
+  if (ctx != NULL_PTR)
+  {
+    Coroutine_StopTimeout(ctx);
+    ctx->line = 0u;
+    ctx->events = 0u;
+    ctx->timedOut = FALSE;
+  }
+}
+
+void Coroutine_PostEvents(Coroutine_ContextType* ctx, const uint32_t events)
+{
+  if (ctx != NULL_PTR)
+  {
+    ctx->events |= events;
+  }
+}
+
+BOOL Coroutine_TakeEvents(Coroutine_ContextType* ctx, const uint32_t mask)
+{
+  /* Local variables */
+  BOOL ret;
+
+  /* Initialize local variables */
+  ret = FALSE;
+
+  if ((ctx != NULL_PTR) && ((ctx->events & mask) != 0u))
+  {
+    ctx->events &= ~mask;
+    ret = TRUE;
+  }
+
+  return ret;
+}
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+void Coroutine_StartTimeout(Coroutine_ContextType* ctx, const uint32_t timeout)
+{
+  ctx->watch = SysTimerIf_GetTicks();
+
+  /* Without a timer (pool empty) the owner has to be woken up otherwise */
+  Coroutine_StopTimeout(ctx);
+  if (ctx->wake != NULL_PTR)
+  {
+    ctx->timer = SysTimerIf_Create(ctx->wake, timeout, 0u);
+  }
+}
+
+BOOL Coroutine_IsTimeout(const Coroutine_ContextType* ctx, const uint32_t timeout)
+{
+  return (BOOL) ((uint32_t) (SysTimerIf_GetTicks() - ctx->watch) >= timeout);
+}
+
+void Coroutine_StopTimeout(Coroutine_ContextType* ctx)
+{
+  /* An expired one-shot timer is freed already, its handle is invalid */
+  if (ctx->timer != SYSTIMERIF_INVALID_HANDLE)
+  {
+    (void) SysTimerIf_Cancel(ctx->timer);
+    ctx->timer = SYSTIMERIF_INVALID_HANDLE;
+  }
+}
+
+/****************************************************************
+ * Static functions
+ ***************************************************************/
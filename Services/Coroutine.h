@@ -0,0 +1,236 @@
+/**
+ ******************************************************************************
+ * @file    Coroutine.h
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Stackless coroutines (protothreads) for driver state machines.
+ *
+ * A coroutine is a function, which returns at each wait and continues at
+ * the same line on the next call (switch on the line stored in its
+ * context). It needs no stack of its own, so local variables are not kept
+ * across waits; state belongs into the context or the driver runtime. The
+ * wait macros must not be used inside a switch statement.
+ *
+ *   static Coroutine_StateType Driver_Exchange(Coroutine_ContextType* ctx)
+ *   {
+ *     COROUTINE_BEGIN(ctx);
+ *     Driver_SendRequest();
+ *     COROUTINE_AWAIT_TIMEOUT(ctx, Coroutine_TakeEvents(ctx, RX), 100u);
+ *     if (COROUTINE_TIMED_OUT(ctx))
+ *       COROUTINE_RESTART(ctx);
+ *     COROUTINE_END(ctx);
+ *   }
+ *
+ * The owner (e.g. a Scheduler task) passes its events with
+ * Coroutine_PostEvents and calls the coroutine again. Timeouts start a
+ * one-shot SysTimerIf timer, whose callback wakes up the owner.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#ifndef COROUTINE_H
+#define COROUTINE_H
+
+#include "Services/StdDef.h"
+#include "Services/SysTimerIf.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/**
+ * Return value of a coroutine.
+ */
+typedef enum
+{
+  Coroutine_Waiting = 0u,
+  Coroutine_Yielded,
+  Coroutine_Ended
+} Coroutine_StateType;
+
+/**
+ * Context of one coroutine.
+ */
+typedef struct
+{
+  /**
+   * Line to continue at, 0 at the beginning.
+   */
+  uint16_t line;
+  /**
+   * Events posted by the owner and not taken yet.
+   */
+  uint32_t events;
+  /**
+   * Start tick and timer of the current timeout.
+   */
+  uint32_t watch;
+  SysTimerIf_HandleType timer;
+  BOOL timedOut;
+  /**
+   * Timer callback, which wakes up the owner (e.g. posts a Scheduler
+   *  event). NULL_PTR if the owner is called cyclically.
+   */
+  const SysTimerIf_CallbackType wake;
+} Coroutine_ContextType;
+
+/****************************************************************
+ * Macros                                                       *
+ ***************************************************************/
+
+/**
+ * Initializer of a context.
+ * @param wake The timer callback, which wakes up the owner.
+ */
+#define COROUTINE_CONTEXT_INIT(wake)                                          \
+  { 0u, 0u, 0u, SYSTIMERIF_INVALID_HANDLE, FALSE, (wake) }
+
+/**
+ * Starts the body of a coroutine.
+ */
+#define COROUTINE_BEGIN(ctx)                                                  \
+  switch ((ctx)->line)                                                        \
+  {                                                                           \
+    case 0u:
+
+/**
+ * Ends the body of a coroutine, the next call starts at the beginning.
+ */
+#define COROUTINE_END(ctx)                                                    \
+  }                                                                           \
+  (ctx)->line = 0u;                                                           \
+  return Coroutine_Ended
+
+/**
+ * Returns and continues after the macro on the next call.
+ */
+#define COROUTINE_YIELD(ctx)                                                  \
+  do                                                                          \
+  {                                                                           \
+    (ctx)->line = (uint16_t) __LINE__;                                        \
+    return Coroutine_Yielded;                                                 \
+    case __LINE__:;                                                           \
+  } while (0)
+
+/**
+ * Waits until the condition is true, evaluated once per call.
+ */
+#define COROUTINE_AWAIT_UNTIL(ctx, condition)                                 \
+  do                                                                          \
+  {                                                                           \
+    (ctx)->line = (uint16_t) __LINE__;                                        \
+    case __LINE__:                                                            \
+    if (!(condition))                                                         \
+    {                                                                         \
+      return Coroutine_Waiting;                                               \
+    }                                                                         \
+  } while (0)
+
+/**
+ * Waits for one of the event bits in mask and takes them.
+ */
+#define COROUTINE_AWAIT_EVENT(ctx, mask)                                      \
+  COROUTINE_AWAIT_UNTIL((ctx), Coroutine_TakeEvents((ctx), (mask)))
+
+/**
+ * Waits until the condition is true, at most timeout SysTimerIf ticks.
+ *  COROUTINE_TIMED_OUT tells afterwards, which one ended the wait.
+ */
+#define COROUTINE_AWAIT_TIMEOUT(ctx, condition, timeout)                      \
+  do                                                                          \
+  {                                                                           \
+    Coroutine_StartTimeout((ctx), (timeout));                                 \
+    (ctx)->line = (uint16_t) __LINE__;                                        \
+    case __LINE__:                                                            \
+    (ctx)->timedOut = FALSE;                                                  \
+    if (!(condition))                                                         \
+    {                                                                         \
+      if (!Coroutine_IsTimeout((ctx), (timeout)))                             \
+      {                                                                       \
+        return Coroutine_Waiting;                                             \
+      }                                                                       \
+      (ctx)->timedOut = TRUE;                                                 \
+    }                                                                         \
+    Coroutine_StopTimeout(ctx);                                               \
+  } while (0)
+
+/**
+ * Checks if the last COROUTINE_AWAIT_TIMEOUT timed out.
+ */
+#define COROUTINE_TIMED_OUT(ctx)        ((ctx)->timedOut)
+
+/**
+ * Waits for the given number of SysTimerIf ticks.
+ */
+#define COROUTINE_DELAY(ctx, ticks)                                           \
+  COROUTINE_AWAIT_TIMEOUT((ctx), FALSE, (ticks))
+
+/**
+ * Returns and starts at the beginning on the next call.
+ */
+#define COROUTINE_RESTART(ctx)                                                \
+  do                                                                          \
+  {                                                                           \
+    Coroutine_StopTimeout(ctx);                                               \
+    (ctx)->line = 0u;                                                         \
+    return Coroutine_Yielded;                                                 \
+  } while (0)
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+/**
+ * Resets a context, the coroutine starts at the beginning on the next call.
+ * @param ctx The context.
+ */
+void Coroutine_Reset(Coroutine_ContextType* ctx);
+
+/**
+ * Passes events of the owner to the coroutine. Call from the owner only.
+ * @param ctx The context.
+ * @param events The event bits.
+ */
+void Coroutine_PostEvents(Coroutine_ContextType* ctx, const uint32_t events);
+
+/**
+ * Takes posted events.
+ * @param ctx The context.
+ * @param mask The event bits to take.
+ * @return TRUE if one of the event bits was posted; otherwise FALSE.
+ */
+BOOL Coroutine_TakeEvents(Coroutine_ContextType* ctx, const uint32_t mask);
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+/**
+ * Starts a timeout and the timer, which wakes up the owner.
+ * @param ctx The context.
+ * @param timeout The timeout in SysTimerIf ticks.
+ */
+void Coroutine_StartTimeout(Coroutine_ContextType* ctx, const uint32_t timeout);
+
+/**
+ * Checks if the timeout elapsed.
+ * @param ctx The context.
+ * @param timeout The timeout in SysTimerIf ticks.
+ * @return TRUE if the timeout elapsed; otherwise FALSE.
+ */
+BOOL Coroutine_IsTimeout(const Coroutine_ContextType* ctx, const uint32_t timeout);
+
+/**
+ * Stops the timer of a timeout.
+ * @param ctx The context.
+ */
+void Coroutine_StopTimeout(Coroutine_ContextType* ctx);
+
+#endif
@@ -0,0 +1,472 @@
+/**
+ ******************************************************************************
+ * @file    FlashLog.c
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Append-only record log on external flash (SpiFlash).
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#include "Services/FlashLog.h"
+#include "Services/CrcIf.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+#define FLASHLOG_MAGIC                    0x474F4C46u
+#define FLASHLOG_ERASED                   0xFFFFFFFFu
+
+/* Requests for a new sector: erase, header and its first record */
+#define FLASHLOG_SECTOR_REQUESTS          3u
+
+#define FLASHLOG_GET_SLOT_SIZE()                                \
+  FLASHLOG_SLOT_SIZE(FlashLog_userCfg->payloadSize)
+
+#define FLASHLOG_GET_RECORDS_PER_SECTOR()                       \
+  ((FlashLog_userCfg->sectorSize - FLASHLOG_HEADER_SIZE) / FLASHLOG_GET_SLOT_SIZE())
+
+/****************************************************************
+ * Function declarations
+ ***************************************************************/
+
+static void FlashLog_ScanHeaders(void);
+static void FlashLog_SearchSlots(void);
+static BOOL FlashLog_StartSector(uint32_t sector);
+static BOOL FlashLog_StartRead(SpiFlash_AddressType address, uint8_t* buffer,
+  SpiFlash_LengthType length);
+static SpiFlash_AddressType FlashLog_GetSectorAddress(uint32_t sector);
+static SpiFlash_AddressType FlashLog_GetRecordAddress(FlashLog_SequenceType sequence);
+static BOOL FlashLog_IsRequestPending(const SpiFlash_RequestType* request);
+static uint32_t FlashLog_CalcCrc(const uint8_t* slot);
+static void FlashLog_PutU32(uint8_t* buffer, uint32_t value);
+static uint32_t FlashLog_GetU32(const uint8_t* buffer);
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+static FlashLog_ConfigType* FlashLog_userCfg = NULL_PTR;
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+void FlashLog_Init(FlashLog_ConfigType* config)
+{
+  /* Local variables */
+  FlashLog_RuntimeType* runtime;
+
+  /* Initialize local variables */
+  runtime = NULL_PTR;
+
+  /* Check user configuration and parameters */
+  if ((FlashLog_userCfg == NULL_PTR) && (config != NULL_PTR))
+  {
+    /* Store given configuration locally */
+    FlashLog_userCfg = config;
+    runtime = config->runtime;
+
+    /* Start mount scan with the first sector */
+    runtime->readRequest.state = SpiFlash_RequestIdle;
+    runtime->eraseRequest.state = SpiFlash_RequestIdle;
+    runtime->headerRequest.state = SpiFlash_RequestIdle;
+    runtime->scanSector = 0u;
+    runtime->sectorFound = FALSE;
+    runtime->nextSequence = 0u;
+    runtime->oldestSequence = 0u;
+    runtime->pendingIdx = 0u;
+    runtime->state = FlashLog_StateScanHeaders;
+  }
+}
+
+void FlashLog_MainFunction(void)
+{
+  /* Check user configuration */
+  if (FlashLog_userCfg != NULL_PTR)
+  {
+    /* Mounting is done step by step, one flash read per call */
+    if (!FlashLog_IsRequestPending(&FlashLog_userCfg->runtime->readRequest))
+    {
+      if (FlashLog_userCfg->runtime->state == FlashLog_StateScanHeaders)
+        FlashLog_ScanHeaders();
+      else if (FlashLog_userCfg->runtime->state == FlashLog_StateSearchSlots)
+        FlashLog_SearchSlots();
+    }
+  }
+}
+
+BOOL FlashLog_IsMounted(void)
+{
+  return (FlashLog_userCfg != NULL_PTR)
+    && (FlashLog_userCfg->runtime->state == FlashLog_StateMounted);
+}
+
+BOOL FlashLog_Append(const uint8_t* payload)
+{
+  /* Local variables */
+  BOOL ret;
+  FlashLog_RuntimeType* runtime;
+  SpiFlash_RequestType* request;
+  uint8_t* slot;
+  uint8_t i;
+
+  /* Initialize local variables */
+  ret = FALSE;
+  runtime = NULL_PTR;
+  request = NULL_PTR;
+  slot = NULL_PTR;
+  i = 0u;
+
+  /* Check state and parameters */
+  if (FlashLog_IsMounted() && (payload != NULL_PTR))
+  {
+    runtime = FlashLog_userCfg->runtime;
+    request = &FlashLog_userCfg->pendingRequests[runtime->pendingIdx];
+    slot = &FlashLog_userCfg->pendingBuffers[runtime->pendingIdx
+      * FLASHLOG_GET_SLOT_SIZE()];
+
+    /* Pending slots are used in order, so the next one is the oldest; a new
+     *  sector has to be erased and stamped first */
+    if (!FlashLog_IsRequestPending(request)
+      && (((runtime->nextSequence % FLASHLOG_GET_RECORDS_PER_SECTOR()) != 0u)
+        || FlashLog_StartSector(runtime->nextSequence / FLASHLOG_GET_RECORDS_PER_SECTOR())))
+    {
+      /* Build record slot */
+      FlashLog_PutU32(slot, runtime->nextSequence);
+      for (i = 0u; i < FlashLog_userCfg->payloadSize; i++)
+        slot[4u + i] = payload[i];
+      FlashLog_PutU32(&slot[4u + FlashLog_userCfg->payloadSize], FlashLog_CalcCrc(slot));
+
+      /* Program record */
+      request->kind = SpiFlash_RequestProgram;
+      request->address = FlashLog_GetRecordAddress(runtime->nextSequence);
+      request->data = slot;
+      request->length = (SpiFlash_LengthType) FLASHLOG_GET_SLOT_SIZE();
+
+      if (SpiFlash_Enqueue(FlashLog_userCfg->flashDevice, request))
+      {
+        runtime->nextSequence++;
+        runtime->pendingIdx = (uint8_t) ((runtime->pendingIdx + 1u)
+          % FlashLog_userCfg->numberOfPending);
+        ret = TRUE;
+      }
+    }
+  }
+
+  return ret;
+}
+
+FlashLog_SequenceType FlashLog_GetOldestSequence(void)
+{
+  return FlashLog_IsMounted() ? FlashLog_userCfg->runtime->oldestSequence : 0u;
+}
+
+FlashLog_SequenceType FlashLog_GetNextSequence(void)
+{
+  return FlashLog_IsMounted() ? FlashLog_userCfg->runtime->nextSequence : 0u;
+}
+
+BOOL FlashLog_Read(FlashLog_SequenceType sequence, uint8_t* payload)
+{
+  /* Local variables */
+  BOOL ret;
+  FlashLog_RuntimeType* runtime;
+
+  /* Initialize local variables */
+  ret = FALSE;
+  runtime = NULL_PTR;
+
+  /* Check state and parameters; programming of pending records is queued
+   *  before the read, so they can be read already */
+  if (FlashLog_IsMounted() && (payload != NULL_PTR)
+    && !FlashLog_IsRequestPending(&FlashLog_userCfg->runtime->readRequest)
+    && (sequence >= FlashLog_userCfg->runtime->oldestSequence)
+    && (sequence < FlashLog_userCfg->runtime->nextSequence))
+  {
+    runtime = FlashLog_userCfg->runtime;
+    runtime->readDestination = payload;
+    runtime->readSequence = sequence;
+    ret = FlashLog_StartRead(FlashLog_GetRecordAddress(sequence),
+      FlashLog_userCfg->readBuffer, (SpiFlash_LengthType) FLASHLOG_GET_SLOT_SIZE());
+  }
+
+  return ret;
+}
+
+FlashLog_ReadResultType FlashLog_GetReadResult(void)
+{
+  /* Local variables */
+  FlashLog_ReadResultType ret;
+  FlashLog_RuntimeType* runtime;
+  const uint8_t* slot;
+  uint16_t i;
+
+  /* Initialize local variables */
+  ret = FlashLog_ReadIdle;
+  runtime = NULL_PTR;
+  slot = NULL_PTR;
+  i = 0u;
+
+  if (FlashLog_IsMounted())
+  {
+    runtime = FlashLog_userCfg->runtime;
+    slot = FlashLog_userCfg->readBuffer;
+
+    if (FlashLog_IsRequestPending(&runtime->readRequest))
+    {
+      ret = FlashLog_ReadPending;
+    }
+    else if (runtime->readRequest.state == SpiFlash_RequestDone)
+    {
+      /* Check record sequence and CRC before handing out the payload */
+      if ((FlashLog_GetU32(slot) == runtime->readSequence)
+        && (FlashLog_GetU32(&slot[4u + FlashLog_userCfg->payloadSize])
+          == FlashLog_CalcCrc(slot)))
+      {
+        for (i = 0u; i < FlashLog_userCfg->payloadSize; i++)
+          runtime->readDestination[i] = slot[4u + i];
+        ret = FlashLog_ReadOk;
+      }
+      else
+      {
+        ret = FlashLog_ReadFailed;
+      }
+      runtime->readRequest.state = SpiFlash_RequestIdle;
+    }
+    else if (runtime->readRequest.state == SpiFlash_RequestFailed)
+    {
+      ret = FlashLog_ReadFailed;
+      runtime->readRequest.state = SpiFlash_RequestIdle;
+    }
+  }
+
+  return ret;
+}
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+/****************************************************************
+ * Static functions
+ ***************************************************************/
+
+static void FlashLog_ScanHeaders(void)
+{
+  /* Local variables */
+  FlashLog_RuntimeType* runtime;
+  uint32_t sector;
+
+  /* Initialize local variables */
+  runtime = FlashLog_userCfg->runtime;
+  sector = 0u;
+
+  if (runtime->readRequest.state == SpiFlash_RequestFailed)
+  {
+    runtime->state = FlashLog_StateError;
+  }
+  else
+  {
+    /* Evaluate header of the last read sector. Only sector sequences which
+     *  belong to this physical sector are valid */
+    if (runtime->readRequest.state == SpiFlash_RequestDone)
+    {
+      sector = FlashLog_GetU32(&runtime->sectorHeader[4]);
+      if ((FlashLog_GetU32(runtime->sectorHeader) == FLASHLOG_MAGIC)
+        && (sector != FLASHLOG_ERASED)
+        && ((sector % FlashLog_userCfg->numberOfSectors) == runtime->scanSector))
+      {
+        if (!runtime->sectorFound || (sector > runtime->newestSector))
+          runtime->newestSector = sector;
+        if (!runtime->sectorFound || (sector < runtime->oldestSector))
+          runtime->oldestSector = sector;
+        runtime->sectorFound = TRUE;
+      }
+      runtime->scanSector++;
+    }
+
+    if (runtime->scanSector < FlashLog_userCfg->numberOfSectors)
+    {
+      /* Read next header */
+      if (!FlashLog_StartRead(FlashLog_GetSectorAddress(runtime->scanSector),
+        runtime->sectorHeader, FLASHLOG_HEADER_SIZE))
+      {
+        runtime->state = FlashLog_StateError;
+      }
+    }
+    else if (runtime->sectorFound)
+    {
+      /* Search first free slot in the newest sector */
+      runtime->oldestSequence = runtime->oldestSector * FLASHLOG_GET_RECORDS_PER_SECTOR();
+      runtime->searchLow = 0u;
+      runtime->searchHigh = (uint16_t) FLASHLOG_GET_RECORDS_PER_SECTOR();
+      runtime->readRequest.state = SpiFlash_RequestIdle;
+      runtime->state = FlashLog_StateSearchSlots;
+    }
+    else
+    {
+      /* Empty log, the first append starts sector 0 */
+      runtime->readRequest.state = SpiFlash_RequestIdle;
+      runtime->state = FlashLog_StateMounted;
+    }
+  }
+}
+
+static void FlashLog_SearchSlots(void)
+{
+  /* Local variables */
+  FlashLog_RuntimeType* runtime;
+  uint16_t mid;
+
+  /* Initialize local variables */
+  runtime = FlashLog_userCfg->runtime;
+  mid = (uint16_t) ((runtime->searchLow + runtime->searchHigh) / 2u);
+
+  if (runtime->readRequest.state == SpiFlash_RequestFailed)
+  {
+    runtime->state = FlashLog_StateError;
+  }
+  else
+  {
+    /* Slots are written in order: used slots, followed by erased ones */
+    if (runtime->readRequest.state == SpiFlash_RequestDone)
+    {
+      if (FlashLog_GetU32(runtime->sectorHeader) != FLASHLOG_ERASED)
+        runtime->searchLow = (uint16_t) (mid + 1u);
+      else
+        runtime->searchHigh = mid;
+      mid = (uint16_t) ((runtime->searchLow + runtime->searchHigh) / 2u);
+    }
+
+    if (runtime->searchLow < runtime->searchHigh)
+    {
+      /* Read sequence of the slot in the middle */
+      if (!FlashLog_StartRead(FlashLog_GetSectorAddress(runtime->newestSector)
+        + FLASHLOG_HEADER_SIZE + (uint32_t) mid * FLASHLOG_GET_SLOT_SIZE(),
+        runtime->sectorHeader, 4u))
+      {
+        runtime->state = FlashLog_StateError;
+      }
+    }
+    else
+    {
+      runtime->nextSequence = runtime->newestSector * FLASHLOG_GET_RECORDS_PER_SECTOR()
+        + runtime->searchLow;
+      runtime->readRequest.state = SpiFlash_RequestIdle;
+      runtime->state = FlashLog_StateMounted;
+    }
+  }
+}
+
+static BOOL FlashLog_StartSector(uint32_t sector)
+{
+  /* Local variables */
+  BOOL ret;
+  FlashLog_RuntimeType* runtime;
+  uint32_t recordsPerSector;
+
+  /* Initialize local variables */
+  ret = FALSE;
+  runtime = FlashLog_userCfg->runtime;
+  recordsPerSector = FLASHLOG_GET_RECORDS_PER_SECTOR();
+
+  /* Erase and header are queued together (with the record following them)
+   *  or not at all, a lone erase would be repeated with the next append */
+  if (!FlashLog_IsRequestPending(&runtime->eraseRequest)
+    && !FlashLog_IsRequestPending(&runtime->headerRequest)
+    && (SpiFlash_GetQueueSpace(FlashLog_userCfg->flashDevice) >= FLASHLOG_SECTOR_REQUESTS))
+  {
+    /* Erase the physical sector (round robin) and write its header */
+    runtime->eraseRequest.kind = SpiFlash_RequestErase;
+    runtime->eraseRequest.address = FlashLog_GetSectorAddress(sector);
+    runtime->eraseRequest.data = NULL_PTR;
+    runtime->eraseRequest.length = 0u;
+
+    FlashLog_PutU32(runtime->sectorHeader, FLASHLOG_MAGIC);
+    FlashLog_PutU32(&runtime->sectorHeader[4], sector);
+    runtime->headerRequest.kind = SpiFlash_RequestProgram;
+    runtime->headerRequest.address = FlashLog_GetSectorAddress(sector);
+    runtime->headerRequest.data = runtime->sectorHeader;
+    runtime->headerRequest.length = FLASHLOG_HEADER_SIZE;
+
+    if (SpiFlash_Enqueue(FlashLog_userCfg->flashDevice, &runtime->eraseRequest)
+      && SpiFlash_Enqueue(FlashLog_userCfg->flashDevice, &runtime->headerRequest))
+    {
+      /* Records of the erased sector are gone */
+      if (sector >= FlashLog_userCfg->numberOfSectors)
+      {
+        if (runtime->oldestSequence
+          < (sector - FlashLog_userCfg->numberOfSectors + 1u) * recordsPerSector)
+        {
+          runtime->oldestSequence =
+            (sector - FlashLog_userCfg->numberOfSectors + 1u) * recordsPerSector;
+        }
+      }
+      ret = TRUE;
+    }
+  }
+
+  return ret;
+}
+
+static BOOL FlashLog_StartRead(SpiFlash_AddressType address, uint8_t* buffer,
+  SpiFlash_LengthType length)
+{
+  /* Read into the given buffer */
+  FlashLog_userCfg->runtime->readRequest.kind = SpiFlash_RequestRead;
+  FlashLog_userCfg->runtime->readRequest.address = address;
+  FlashLog_userCfg->runtime->readRequest.data = buffer;
+  FlashLog_userCfg->runtime->readRequest.length = length;
+
+  return SpiFlash_Enqueue(FlashLog_userCfg->flashDevice,
+    &FlashLog_userCfg->runtime->readRequest);
+}
+
+static SpiFlash_AddressType FlashLog_GetSectorAddress(uint32_t sector)
+{
+  return (FlashLog_userCfg->firstSector + (sector % FlashLog_userCfg->numberOfSectors))
+    * FlashLog_userCfg->sectorSize;
+}
+
+static SpiFlash_AddressType FlashLog_GetRecordAddress(FlashLog_SequenceType sequence)
+{
+  return FlashLog_GetSectorAddress(sequence / FLASHLOG_GET_RECORDS_PER_SECTOR())
+    + FLASHLOG_HEADER_SIZE
+    + (sequence % FLASHLOG_GET_RECORDS_PER_SECTOR()) * FLASHLOG_GET_SLOT_SIZE();
+}
+
+static BOOL FlashLog_IsRequestPending(const SpiFlash_RequestType* request)
+{
+  return (request->state == SpiFlash_RequestQueued)
+    || (request->state == SpiFlash_RequestBusy);
+}
+
+static uint32_t FlashLog_CalcCrc(const uint8_t* slot)
+{
+  /* CRC over record sequence and payload */
+  CrcIf_Reset();
+  return CrcIf_CalcBlock8(slot, 4u + FlashLog_userCfg->payloadSize);
+}
+
+static void FlashLog_PutU32(uint8_t* buffer, uint32_t value)
+{
+  buffer[0] = (uint8_t) value;
+  buffer[1] = (uint8_t) (value >> 8);
+  buffer[2] = (uint8_t) (value >> 16);
+  buffer[3] = (uint8_t) (value >> 24);
+}
+
+static uint32_t FlashLog_GetU32(const uint8_t* buffer)
+{
+  return (uint32_t) buffer[0] | ((uint32_t) buffer[1] << 8)
+    | ((uint32_t) buffer[2] << 16) | ((uint32_t) buffer[3] << 24);
+}
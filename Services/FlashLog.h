@@ -0,0 +1,185 @@
+/**
+ ******************************************************************************
+ * @file    FlashLog.h
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Append-only record log on external flash (SpiFlash).
+ *
+ * Records of fixed size are appended to sectors, which are used round
+ * robin: sector sequence k is stored in physical sector k % numberOfSectors
+ * and holds the records k * R ... k * R + R - 1 (R records per sector).
+ * Mounting reads the sector headers only and searches the newest sector
+ * binary for its first free slot.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#ifndef FLASHLOG_H
+#define FLASHLOG_H
+
+#include "Services/StdDef.h"
+#include "Devices/SpiFlash.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/* Sector header: magic and sector sequence */
+#define FLASHLOG_HEADER_SIZE              8u
+
+/* Record slot: record sequence, payload and CRC */
+#define FLASHLOG_SLOT_SIZE(payloadSize)   (4u + (payloadSize) + 4u)
+
+typedef uint32_t FlashLog_SequenceType;
+
+typedef enum
+{
+  FlashLog_StateUnmounted = 0u,
+  FlashLog_StateScanHeaders,
+  FlashLog_StateSearchSlots,
+  FlashLog_StateMounted,
+  FlashLog_StateError
+} FlashLog_StateType;
+
+typedef enum
+{
+  FlashLog_ReadIdle = 0u,
+  FlashLog_ReadPending,
+  FlashLog_ReadOk,
+  FlashLog_ReadFailed
+} FlashLog_ReadResultType;
+
+/**
+ * Runtime data of the log.
+ */
+typedef struct
+{
+  FlashLog_StateType state;
+  /**
+   * Request for mount and record reads.
+   */
+  SpiFlash_RequestType readRequest;
+  uint8_t* readDestination;
+  FlashLog_SequenceType readSequence;
+  /**
+   * Mount scan: current sector, found sector sequences and search range.
+   */
+  uint16_t scanSector;
+  BOOL sectorFound;
+  uint32_t newestSector;
+  uint32_t oldestSector;
+  uint16_t searchLow;
+  uint16_t searchHigh;
+  /**
+   * Sequence of the next record to append and of the oldest stored record.
+   */
+  FlashLog_SequenceType nextSequence;
+  FlashLog_SequenceType oldestSequence;
+  /**
+   * Requests and header buffer for starting a new sector.
+   */
+  SpiFlash_RequestType eraseRequest;
+  SpiFlash_RequestType headerRequest;
+  uint8_t sectorHeader[FLASHLOG_HEADER_SIZE];
+  /**
+   * Next pending append slot.
+   */
+  uint8_t pendingIdx;
+} FlashLog_RuntimeType;
+
+typedef struct
+{
+  const uint8_t flashDevice;
+  const uint16_t firstSector;
+  const uint16_t numberOfSectors;
+  const uint32_t sectorSize;
+  const uint16_t payloadSize;
+  /**
+   * Number of appends which may be in progress at once, each with a request
+   *  and a slot buffer. The SpiFlash queue needs room for them plus two.
+   */
+  const uint8_t numberOfPending;
+  SpiFlash_RequestType* const pendingRequests;
+  uint8_t* const pendingBuffers;
+  /**
+   * Slot buffer for reads.
+   */
+  uint8_t* const readBuffer;
+  FlashLog_RuntimeType* const runtime;
+} FlashLog_ConfigType;
+
+/****************************************************************
+ * Macros                                                       *
+ ***************************************************************/
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+extern FlashLog_ConfigType FlashLog_config;
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+/**
+ * Initialize the log and start mounting.
+ * @param config Pointer to the configuration.
+ */
+void FlashLog_Init(FlashLog_ConfigType* config);
+
+/**
+ * Mounts the log, has to be called cyclically (after SpiFlash_MainFunction).
+ */
+void FlashLog_MainFunction(void);
+
+/**
+ * Checks if the log is mounted.
+ * @return TRUE if records may be appended and read; otherwise FALSE.
+ */
+BOOL FlashLog_IsMounted(void);
+
+/**
+ * Appends a record. Returns immediately, the record is programmed by
+ *  SpiFlash in the background.
+ * @param payload The record payload (payloadSize bytes).
+ * @return TRUE if the record was queued; otherwise FALSE (all pending
+ *  slots in use or not mounted).
+ */
+BOOL FlashLog_Append(const uint8_t* payload);
+
+/**
+ * Gets the sequence number of the oldest stored record.
+ * @return The sequence number.
+ */
+FlashLog_SequenceType FlashLog_GetOldestSequence(void);
+
+/**
+ * Gets the sequence number the next appended record will get.
+ * @return The sequence number.
+ */
+FlashLog_SequenceType FlashLog_GetNextSequence(void);
+
+/**
+ * Starts reading a record.
+ * @param sequence The sequence number of the record.
+ * @param payload Destination for the payload (payloadSize bytes).
+ * @return TRUE if the read was started; otherwise FALSE.
+ */
+BOOL FlashLog_Read(FlashLog_SequenceType sequence, uint8_t* payload);
+
+/**
+ * Gets the result of the last read. A finished result is reported once.
+ * @return FlashLog_ReadOk if the payload was copied, FlashLog_ReadFailed
+ *  on a flash or CRC error.
+ */
+FlashLog_ReadResultType FlashLog_GetReadResult(void);
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+#endif
@@ -0,0 +1,63 @@
+/**
+ ******************************************************************************
+ * @file    FlashLog_Cfg.c
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Configuration of the append-only record log.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#include "Services/FlashLog.h"
+#include "Services/FlashLog_Cfg.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+/****************************************************************
+ * Function declarations
+ ***************************************************************/
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+static SpiFlash_RequestType FlashLog_pendingRequests[FLASHLOG_NUMBER_OF_PENDING];
+static uint8_t FlashLog_pendingBuffers[FLASHLOG_NUMBER_OF_PENDING]
+  [FLASHLOG_SLOT_SIZE(FLASHLOG_PAYLOAD_SIZE)];
+static uint8_t FlashLog_readBuffer[FLASHLOG_SLOT_SIZE(FLASHLOG_PAYLOAD_SIZE)];
+static FlashLog_RuntimeType FlashLog_runtime;
+
+FlashLog_ConfigType FlashLog_config =
+{
+  FLASHLOG_FLASH_DEVICE,
+  FLASHLOG_FIRST_SECTOR,
+  FLASHLOG_NUMBER_OF_SECTORS,
+  FLASHLOG_SECTOR_SIZE,
+  FLASHLOG_PAYLOAD_SIZE,
+  FLASHLOG_NUMBER_OF_PENDING,
+  FlashLog_pendingRequests,
+  &FlashLog_pendingBuffers[0][0],
+  FlashLog_readBuffer,
+  &FlashLog_runtime
+};
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+/****************************************************************
+ * Static functions
+ ***************************************************************/
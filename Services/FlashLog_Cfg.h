@@ -0,0 +1,32 @@
+/**
+ ******************************************************************************
+ * @file    FlashLog_Cfg.h
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Configuration of the append-only record log.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#ifndef FLASHLOG_CFG_H
+#define FLASHLOG_CFG_H
+
+#include "Services/StdDef.h"
+#include "Devices/SpiFlash_Cfg.h"
+
+/* Flash area: whole device 0 */
+#define FLASHLOG_FLASH_DEVICE             0u
+#define FLASHLOG_FIRST_SECTOR             0u
+#define FLASHLOG_NUMBER_OF_SECTORS        (SPIFLASH_SIZE0 / SPIFLASH_SECTOR_SIZE0)
+#define FLASHLOG_SECTOR_SIZE              SPIFLASH_SECTOR_SIZE0
+
+/* Records */
+#define FLASHLOG_PAYLOAD_SIZE             24u
+
+/* Appends in progress, SPIFLASH_REQUEST_QUEUE_SIZE0 has to be 2 larger */
+#define FLASHLOG_NUMBER_OF_PENDING        2u
+
+#endif
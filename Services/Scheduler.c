@@ -0,0 +1,137 @@
+/**
+ ******************************************************************************
+ * @file    Scheduler.c
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Event driven run-to-completion scheduler.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#include "Scheduler.h"
+#include "stm32f0xx_conf.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+/****************************************************************
+ * Function declarations
+ ***************************************************************/
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+/**
+ * A pointer to the internal configuration.
+ */
+static Scheduler_ConfigType* Scheduler_userCfg = NULL_PTR;
+
+/**
+ * Ready tasks, bit n is set if task n has pending events.
+ */
+static volatile uint32_t Scheduler_readyTasks = 0u;
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+void Scheduler_Init(Scheduler_ConfigType* config)
+{
+  /* Local variables */
+  uint8_t task;
+
+  if ((Scheduler_userCfg == NULL_PTR) && (config != NULL_PTR)
+    && (config->numberOfTasks <= SCHEDULER_MAX_TASKS))
+  {
+    Scheduler_userCfg = config;
+
+    for (task = 0u; task < config->numberOfTasks; task++)
+    {
+      Scheduler_SetEvent(task, SCHEDULER_EVENT_START);
+    }
+  }
+}
+
+void Scheduler_MainFunction(void)
+{
+  /* Local variables */
+  uint32_t primask;
+  uint32_t ready;
+  uint8_t task;
+  Scheduler_EventType events;
+  Scheduler_TaskConfigType* taskConfig;
+
+  /* Initialize local variables */
+  task = 0u;
+  events = 0u;
+
+  if (Scheduler_userCfg != NULL_PTR)
+  {
+    /* Events posted after the check wake up the sleep function */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    ready = Scheduler_readyTasks;
+
+    if (ready == 0u)
+    {
+      if (Scheduler_userCfg->idle != NULL_PTR)
+      {
+        Scheduler_userCfg->idle();
+      }
+      else
+      {
+        __WFI();
+      }
+      __set_PRIMASK(primask);
+    }
+    else
+    {
+      /* Highest priority first */
+      while ((ready & 1u) == 0u)
+      {
+        ready >>= 1u;
+        task++;
+      }
+      taskConfig = &Scheduler_userCfg->taskConfigs[task];
+      events = taskConfig->events;
+      taskConfig->events = 0u;
+      Scheduler_readyTasks &= ~(1u << task);
+      __set_PRIMASK(primask);
+
+      taskConfig->function(events);
+    }
+  }
+}
+
+void Scheduler_SetEvent(const uint8_t task, const Scheduler_EventType events)
+{
+  /* Local variables */
+  uint32_t primask;
+
+  if ((Scheduler_userCfg != NULL_PTR) && (task < Scheduler_userCfg->numberOfTasks)
+    && (events != 0u))
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    Scheduler_userCfg->taskConfigs[task].events |= events;
+    Scheduler_readyTasks |= (1u << task);
+    __set_PRIMASK(primask);
+  }
+}
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+/****************************************************************
+ * Static functions
+ ***************************************************************/
@@ -0,0 +1,125 @@
+/**
+ ******************************************************************************
+ * @file    Scheduler.h
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Event driven run-to-completion scheduler.
+ *
+ * Interrupts (and tasks) post event bits to tasks. The scheduler runs the
+ * ready task with the highest priority (lowest index) with its pending
+ * events and sleeps if no task is ready.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include "Services/StdDef.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/**
+ * Event bits of one task.
+ */
+typedef uint32_t Scheduler_EventType;
+
+/**
+ * Task function, runs to completion.
+ * @param events The events posted since the last run.
+ */
+typedef void (*Scheduler_TaskFunctionType)(const Scheduler_EventType events);
+
+/**
+ * Sleep function, called with interrupts disabled. It has to return on
+ *  pending interrupts (e.g. WFI).
+ */
+typedef void (*Scheduler_IdleType)(void);
+
+/**
+ * Defines one task.
+ */
+typedef struct
+{
+  const Scheduler_TaskFunctionType function;
+  /**
+   * Events posted since the last run.
+   */
+  volatile Scheduler_EventType events;
+} Scheduler_TaskConfigType;
+
+/**
+ * A Scheduler module config type.
+ */
+typedef struct
+{
+  /**
+   * Number of tasks, at most SCHEDULER_MAX_TASKS. Tasks are ordered by
+   *  priority, task 0 has the highest.
+   */
+  const uint8_t numberOfTasks;
+  Scheduler_TaskConfigType* taskConfigs;
+  /**
+   * Sleep function, NULL_PTR for WFI.
+   */
+  const Scheduler_IdleType idle;
+} Scheduler_ConfigType;
+
+/****************************************************************
+ * Macros                                                       *
+ ***************************************************************/
+
+/**
+ * Maximum number of tasks.
+ */
+#define SCHEDULER_MAX_TASKS             32u
+
+/**
+ * Posted to all tasks by Scheduler_Init.
+ */
+#define SCHEDULER_EVENT_START           0x80000000u
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+/**
+ * Compile time configuration.
+ */
+extern Scheduler_ConfigType Scheduler_config;
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+/**
+ * Initialize the scheduler, each task is run once with
+ *  SCHEDULER_EVENT_START.
+ * @param config Pointer to the configuration.
+ */
+void Scheduler_Init(Scheduler_ConfigType* config);
+
+/**
+ * Runs the ready task with the highest priority or sleeps until the next
+ *  interrupt if no task is ready. Replaces the module main functions in
+ *  the main loop.
+ */
+void Scheduler_MainFunction(void);
+
+/**
+ * Posts events to a task. Interrupt safe.
+ * @param task The task.
+ * @param events The event bits.
+ */
+void Scheduler_SetEvent(const uint8_t task, const Scheduler_EventType events);
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+#endif
@@ -0,0 +1,130 @@
+/**
+ ******************************************************************************
+ * @file    Scheduler_Cfg.c
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Configuration for Scheduler module.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#include "Scheduler.h"
+#include "Scheduler_Cfg.h"
+
+/* tasks */
+#include "Services/SysTimerIf.h"
+#include "Services/FlashLog.h"
+#include "Devices/Bluemod.h"
+#include "Devices/SpiFlash.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+/****************************************************************
+ * Function declarations
+ ***************************************************************/
+
+/**
+ * Runs the SysTimerIf callbacks.
+ * @param events The posted events.
+ */
+static void Scheduler_SysTimerTask(const Scheduler_EventType events);
+
+/**
+ * Runs Bluemod.
+ * @param events The posted events.
+ */
+static void Scheduler_BluemodTask(const Scheduler_EventType events);
+
+/**
+ * Runs SpiFlash and FlashLog.
+ * @param events The posted events.
+ */
+static void Scheduler_StorageTask(const Scheduler_EventType events);
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+static Scheduler_TaskConfigType Scheduler_taskConfigs[SCHEDULER_NUMBER_OF_TASKS] =
+{
+  {
+    Scheduler_SysTimerTask,
+    0u
+  },
+  {
+    Scheduler_BluemodTask,
+    0u
+  },
+  {
+    Scheduler_StorageTask,
+    0u
+  }
+};
+
+Scheduler_ConfigType Scheduler_config =
+{
+  SCHEDULER_NUMBER_OF_TASKS,
+  Scheduler_taskConfigs,
+  SCHEDULER_IDLE
+};
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+void Scheduler_SysTimerNotification(void)
+{
+  Scheduler_SetEvent(SCHEDULER_TASK_SYSTIMER, SCHEDULER_EVENT_TIMER_EXPIRED);
+}
+
+void Scheduler_UartRxNotification(const uint8_t channel)
+{
+  (void) channel;
+  Scheduler_SetEvent(SCHEDULER_TASK_BLUEMOD, SCHEDULER_EVENT_UART_RX);
+}
+
+void Scheduler_BluemodNotification(void)
+{
+  Scheduler_SetEvent(SCHEDULER_TASK_BLUEMOD, SCHEDULER_EVENT_BLUEMOD_WORK);
+}
+
+void Scheduler_SpiFlashNotification(void)
+{
+  Scheduler_SetEvent(SCHEDULER_TASK_STORAGE, SCHEDULER_EVENT_SPIFLASH);
+}
+
+/****************************************************************
+ * Static functions
+ ***************************************************************/
+
+static void Scheduler_SysTimerTask(const Scheduler_EventType events)
+{
+  (void) events;
+  SysTimerIf_MainFunction();
+}
+
+static void Scheduler_BluemodTask(const Scheduler_EventType events)
+{
+  (void) events;
+  Bluemod_MainFunction();
+}
+
+static void Scheduler_StorageTask(const Scheduler_EventType events)
+{
+  (void) events;
+  SpiFlash_MainFunction();
+  FlashLog_MainFunction();
+}
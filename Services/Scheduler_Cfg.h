@@ -0,0 +1,70 @@
+/**
+ ******************************************************************************
+ * @file    Scheduler_Cfg.h
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Configuration for Scheduler module.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#ifndef SCHEDULER_CFG_H
+#define SCHEDULER_CFG_H
+
+#include "Services/StdDef.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+/* Generic */
+#define SCHEDULER_NUMBER_OF_TASKS       3u
+#define SCHEDULER_IDLE                  SysTimerIf_Idle
+
+/* Task 0, SysTimerIf callbacks */
+#define SCHEDULER_TASK_SYSTIMER         0u
+#define SCHEDULER_EVENT_TIMER_EXPIRED   0x01u
+
+/* Task 1, Bluemod */
+#define SCHEDULER_TASK_BLUEMOD          1u
+#define SCHEDULER_EVENT_UART_RX         0x01u
+#define SCHEDULER_EVENT_BLUEMOD_WORK    0x02u
+
+/* Task 2, SpiFlash and FlashLog */
+#define SCHEDULER_TASK_STORAGE          2u
+#define SCHEDULER_EVENT_SPIFLASH        0x01u
+
+/****************************************************************
+ * Internal functions/callbacks
+ ***************************************************************/
+
+/**
+ * SysTimerIf expiry notification, posts SCHEDULER_EVENT_TIMER_EXPIRED.
+ */
+void Scheduler_SysTimerNotification(void);
+
+/**
+ * UartIf receive notification, posts SCHEDULER_EVENT_UART_RX.
+ * @param channel The UartIf channel.
+ */
+void Scheduler_UartRxNotification(const uint8_t channel);
+
+/**
+ * Bluemod notification on queued commands and ended timeouts, posts
+ * SCHEDULER_EVENT_BLUEMOD_WORK.
+ */
+void Scheduler_BluemodNotification(void);
+
+/**
+ * SpiFlash notification, posts SCHEDULER_EVENT_SPIFLASH.
+ */
+void Scheduler_SpiFlashNotification(void);
+
+#endif
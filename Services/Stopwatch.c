@@ -13,6 +13,7 @@
  */
 
 #include "Stopwatch.h"
+#include "Services/SysTimerIf.h"
 
 /****************************************************************
  * Type definitions
@@ -30,7 +31,11 @@
  * Global variables
  ***************************************************************/
 
-static uint32_t Stopwatch_currentValue;
+/**
+ * SysTimerIf tick at initialization. The SysTimerIf ticks are counted
+ * across tickless idle periods, a callback per tick would not be.
+ */
+static uint32_t Stopwatch_startTicks;
 
 /****************************************************************
  * User functions
@@ -38,12 +43,12 @@ static uint32_t Stopwatch_currentValue;
 
 void Stopwatch_Init(void)
 {
-  Stopwatch_currentValue = 0u;
+  Stopwatch_startTicks = SysTimerIf_GetTicks();
 }
 
 uint32_t Stopwatch_GetCurrentValue(void)
 {
-  return Stopwatch_currentValue;
+  return SysTimerIf_GetTicks() - Stopwatch_startTicks;
 }
 
 uint32_t Stopwatch_ReturnDifference(const uint32_t start, const uint32_t stop)
@@ -55,11 +60,6 @@ uint32_t Stopwatch_ReturnDifference(const uint32_t start, const uint32_t stop)
  * Internal functions/callbacks
  ***************************************************************/
 
-void Stopwatch_MsTimer(void)
-{
-  Stopwatch_currentValue++;
-}
-
 /****************************************************************
  * Static functions
  ***************************************************************/
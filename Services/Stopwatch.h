@@ -40,7 +40,7 @@ void Stopwatch_Init(void);
 
 /**
  * Gets the current stopwatch value.
- * @return The current stopwatch value.
+ * @return The current stopwatch value in SysTimerIf ticks (ms).
  */
 uint32_t Stopwatch_GetCurrentValue(void);
 
@@ -56,9 +56,4 @@ uint32_t Stopwatch_ReturnDifference(const uint32_t start, const uint32_t stop);
  * Internal functions/callbacks
  ***************************************************************/
 
-/**
- * Stopwatch ms timer callback.
- */
-void Stopwatch_MsTimer(void);
-
 #endif
@@ -13,6 +13,7 @@
 #include "SysState.h"
 
 #include "BSP/Led.h"
+#include "Services/SysTimerIf.h"
 
 /****************************************************************
  * Type definitions
@@ -26,6 +27,12 @@
  * Function declarations
  ***************************************************************/
 
+/**
+ * Restarts the SysTimerIf channel for the earliest pending fall back, stops
+ *  it if none is pending.
+ */
+static void SysState_StartFallBackTimer(void);
+
 /****************************************************************
  * Global variables
  ***************************************************************/
@@ -48,8 +55,11 @@ void SysState_Init(const SysState_ConfigType* config)
 
     for (channel = 0u; channel < config->numberOfChannels; channel++)
     {
+      *config->channels[channel].fallBackPending = FALSE;
       SysState_SetState(channel, SysState_StateUninitialized);
     }
+
+    SysState_StartFallBackTimer();
   }
 }
 
@@ -109,11 +119,21 @@ BOOL SysState_SetState(const uint8_t channel, const SysState_StateType newState)
       if (ret)
       {
         *channelConfig->currentState = newState;
-        *channelConfig->fallBackTime = 0u;
+
         if (newStateConfig->fallBackTimeout == SYSSTATE_FALL_BACK_DISABLE)
         {
           *channelConfig->fallBackState = newState;
+          *channelConfig->fallBackPending = FALSE;
         }
+        else
+        {
+          *channelConfig->fallBackTime = SysTimerIf_GetTicks()
+            + newStateConfig->fallBackTimeout;
+          *channelConfig->fallBackPending = TRUE;
+        }
+
+        /* No periodic tick, the timer wakes up at the next fall back only */
+        SysState_StartFallBackTimer();
       }
     }
   }
@@ -125,7 +145,7 @@ BOOL SysState_SetState(const uint8_t channel, const SysState_StateType newState)
  * Internal functions/callbacks
  ***************************************************************/
 
-void SysState_MsTimer(void)
+void SysState_FallBackTimer(void)
 {
   /* Local variables */
   uint8_t channel;
@@ -142,14 +162,16 @@ void SysState_MsTimer(void)
     {
       channelConfig = &SysState_userCfg->channels[channel];
 
-      (*channelConfig->fallBackTime)++;
-
-      if ((*channelConfig->fallBackTime)
-        > channelConfig->stateConfig[*channelConfig->currentState].fallBackTimeout)
+      if (*channelConfig->fallBackPending
+        && ((int32_t) (SysTimerIf_GetTicks() - *channelConfig->fallBackTime) >= 0))
       {
-        SysState_SetState(channel, *channelConfig->fallBackState);
+        *channelConfig->fallBackPending = FALSE;
+        (void) SysState_SetState(channel, *channelConfig->fallBackState);
       }
     }
+
+    /* Next fall back, stops the channel activated at compile time if none */
+    SysState_StartFallBackTimer();
   }
 }
 
@@ -157,3 +179,44 @@ void SysState_MsTimer(void)
  * Static functions
  ***************************************************************/
 
+static void SysState_StartFallBackTimer(void)
+{
+  /* Local variables */
+  uint8_t channel;
+  const SysState_ChannelConfigType* channelConfig;
+  BOOL pending;
+  int32_t remaining;
+  int32_t next;
+
+  /* Initialize local variables */
+  channel = 0u;
+  channelConfig = NULL_PTR;
+  pending = FALSE;
+  remaining = 0;
+  next = 0;
+
+  for (channel = 0u; channel < SysState_userCfg->numberOfChannels; channel++)
+  {
+    channelConfig = &SysState_userCfg->channels[channel];
+
+    if (*channelConfig->fallBackPending)
+    {
+      remaining = (int32_t) (*channelConfig->fallBackTime - SysTimerIf_GetTicks());
+      if (!pending || (remaining < next))
+      {
+        next = remaining;
+      }
+      pending = TRUE;
+    }
+  }
+
+  if (pending)
+  {
+    SysTimerIf_Start(SysState_userCfg->sysTimerChannel,
+      (next > 0) ? (uint32_t) next : 1u);
+  }
+  else
+  {
+    SysTimerIf_Stop(SysState_userCfg->sysTimerChannel);
+  }
+}
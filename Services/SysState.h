@@ -71,9 +71,10 @@ typedef struct
    */
   SysState_StateType* fallBackState;
   /**
-   * Current fall back timeout
+   * Tick of the fall back and if it is pending
    */
   uint32_t* fallBackTime;
+  BOOL* fallBackPending;
   /**
    * configuration of all states
    */
@@ -91,6 +92,11 @@ typedef struct
    * configuration of all channels
    */
   const SysState_ChannelConfigType* channels;
+  /**
+   * SysTimerIf channel with SysState_FallBackTimer as callback, restarted
+   *  for the next pending fall back
+   */
+  const uint8_t sysTimerChannel;
 } SysState_ConfigType;
 
 /****************************************************************
@@ -136,6 +142,10 @@ BOOL SysState_SetState(const uint8_t channel,
  * Internal functions/callbacks
  ***************************************************************/
 
-void SysState_MsTimer(void);
+/**
+ * Falls back the channels whose fall back timeout expired. Callback of the
+ *  SysTimerIf channel of SysState.
+ */
+void SysState_FallBackTimer(void);
 
 #endif
@@ -31,7 +31,8 @@
 
 static SysState_StateType SysState_currentState0;
 static SysState_StateType SysState_fallBackState0;
-static uint32_t SysState_currentFallBackTimeout0;
+static uint32_t SysState_fallBackTime0;
+static BOOL SysState_fallBackPending0;
 static const SysState_StateConfigType SysState_stateConfigs0[SysState_StateLast] =
 {
   {
@@ -86,7 +87,8 @@ static const SysState_StateConfigType SysState_stateConfigs0[SysState_StateLast]
 
 static SysState_StateType SysState_currentState1;
 static SysState_StateType SysState_fallBackState1;
-static uint32_t SysState_currentFallBackTimeout1;
+static uint32_t SysState_fallBackTime1;
+static BOOL SysState_fallBackPending1;
 static const SysState_StateConfigType SysState_stateConfigs1[SysState_StateLast] =
 {
   {
@@ -141,7 +143,8 @@ static const SysState_StateConfigType SysState_stateConfigs1[SysState_StateLast]
 
 static SysState_StateType SysState_currentState2;
 static SysState_StateType SysState_fallBackState2;
-static uint32_t SysState_currentFallBackTimeout2;
+static uint32_t SysState_fallBackTime2;
+static BOOL SysState_fallBackPending2;
 static const SysState_StateConfigType SysState_stateConfigs2[SysState_StateLast] =
 {
   {
@@ -200,21 +203,24 @@ static const SysState_ChannelConfigType SysState_channelConfigs[SYSSTATE_NUMBER_
   {
     &SysState_currentState0,
     &SysState_fallBackState0,
-    &SysState_currentFallBackTimeout0,
+    &SysState_fallBackTime0,
+    &SysState_fallBackPending0,
     SysState_stateConfigs0
   },
   /* Channel 1 */
   {
     &SysState_currentState1,
     &SysState_fallBackState1,
-    &SysState_currentFallBackTimeout1,
+    &SysState_fallBackTime1,
+    &SysState_fallBackPending1,
     SysState_stateConfigs1
   },
   /* Channel 2 */
   {
     &SysState_currentState2,
     &SysState_fallBackState2,
-    &SysState_currentFallBackTimeout2,
+    &SysState_fallBackTime2,
+    &SysState_fallBackPending2,
     SysState_stateConfigs2
   }
 };
@@ -222,7 +228,8 @@ static const SysState_ChannelConfigType SysState_channelConfigs[SYSSTATE_NUMBER_
 const SysState_ConfigType SysState_config =
 {
   SYSSTATE_NUMBER_OF_CHANNELS,
-  SysState_channelConfigs
+  SysState_channelConfigs,
+  SYSSTATE_SYSTIMER_CHANNEL
 };
 
 /****************************************************************
@@ -21,6 +21,7 @@
 
 /* Generic */
 #define SYSSTATE_NUMBER_OF_CHANNELS                             3u
+#define SYSSTATE_SYSTIMER_CHANNEL                               1u
 
 /****************************************************************
  * Channel 0
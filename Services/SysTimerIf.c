@@ -13,6 +13,7 @@
 
 #include "SysTimerIf.h"
 #include "stm32f0xx_conf.h"
+#include <string.h>
 
 /*SysTick clock*/
 #include "stm32f0xx_rcc.h"
@@ -41,6 +42,46 @@
  * Function declarations
  ***************************************************************/
 
+/**
+ * Adds an active channel to the wheel slot of its expiry.
+ * @param channel The channel.
+ */
+static void SysTimerIf_WheelInsert(const uint8_t channel);
+
+/**
+ * Removes an active channel from its wheel slot.
+ * @param channel The channel.
+ */
+static void SysTimerIf_WheelRemove(const uint8_t channel);
+
+/**
+ * Gets the pool channel of a handle.
+ * @param handle The handle.
+ * @return The channel, SYSTIMERIF_CHANNEL_NONE if the handle is invalid.
+ */
+static uint8_t SysTimerIf_GetPoolChannel(const SysTimerIf_HandleType handle);
+
+/**
+ * Frees a pool channel.
+ * @param channel The channel.
+ */
+static void SysTimerIf_Free(const uint8_t channel);
+
+/**
+ * Gets the number of ticks until the next expiry.
+ * @param maxTicks The value returned if no channel is active.
+ * @return The number of ticks, 0 if callbacks are pending.
+ */
+static uint32_t SysTimerIf_GetIdleTicks(const uint32_t maxTicks);
+
+/**
+ * Adds a value to a measurement.
+ * @param measurement The measurement.
+ * @param value The value in cycles.
+ */
+static void SysTimerIf_Measure(SysTimerIf_MeasurementType* measurement,
+                               const uint32_t value);
+
 /****************************************************************
  * Global variables
  ***************************************************************/
@@ -50,6 +91,16 @@
  */
 static const SysTimerIf_ConfigType* SysTimerIf_userCfg = NULL_PTR;
 
+/**
+ * Number of SysTick interrupts since initialization.
+ */
+static volatile uint32_t SysTimerIf_ticks = 0u;
+
+/**
+ * SysTick reload value of one tick.
+ */
+static uint32_t SysTimerIf_reload = 0u;
+
 /****************************************************************
  * User functions
  ***************************************************************/
@@ -57,11 +108,31 @@ static const SysTimerIf_ConfigType* SysTimerIf_userCfg = NULL_PTR;
 void SysTimerIf_Init(SysTimerIf_ConfigType* config)
 {
   RCC_ClocksTypeDef RCC_Clocks;
+  uint8_t i;
+  SysTimerIf_ChannelConfigType* channel;
 
   if (config != NULL_PTR && SysTimerIf_userCfg == NULL_PTR)
   {
     SysTimerIf_userCfg = config;
 
+    /* Sort the channels activated at compile time into the wheel */
+    for (i = 0u; i < config->wheelSize; i++)
+    {
+      config->wheel[i] = SYSTIMERIF_CHANNEL_NONE;
+    }
+    for (i = 0u; i < config->numberOfChannels; i++)
+    {
+      channel = &config->channelConfigs[i];
+      if (channel->isActivated)
+      {
+        if (channel->reload == 0u)
+          channel->reload = 1u;
+        channel->expiry = SysTimerIf_ticks
+          + ((channel->timeout != 0u) ? channel->timeout : 1u);
+        SysTimerIf_WheelInsert(i);
+      }
+    }
+
     /* SysTick end of count event each 1ms */
     RCC_GetClocksFreq(&RCC_Clocks);
 
@@ -69,6 +140,7 @@ void SysTimerIf_Init(SysTimerIf_ConfigType* config)
     SysTick_CLKSourceConfig(SysTick_CLKSource_HCLK);
     /* Configures the SysTick Timer to generate an interrupt every millisecond (48000000Hz / 1000) */
     SysTick_Config(RCC_Clocks.HCLK_Frequency / SysTimerIf_userCfg->timeResolution);
+    SysTimerIf_reload = SysTick->LOAD;
   }
 }
 
@@ -76,27 +148,83 @@ void SysTimerIf_MainFunction(void)
 {
   /* Local variables */
   uint8_t i;
+  uint8_t generation;
+  uint16_t count;
+  uint16_t due;
+  uint32_t start;
   SysTimerIf_ChannelConfigType* channel;
 
   /* Initialize local variables */
   i = 0u;
   channel = NULL_PTR;
 
+  /* The SysTick interrupt stays enabled, expirations during the callbacks
+   * are counted and handled by the next call */
   if (SysTimerIf_userCfg != NULL_PTR)
   {
-    /* Enter the Critical Section. */
-    SYSTIMERIF_ENTER_CS();
-    for (i = 0u; i < SysTimerIf_userCfg->numberOfChannels; i++)
+    for (i = 0u; i < (SysTimerIf_userCfg->numberOfChannels
+      + SysTimerIf_userCfg->poolSize); i++)
     {
       channel = &SysTimerIf_userCfg->channelConfigs[i];
-      if ((channel->expired) && (channel->callback != NULL_PTR))
+      count = channel->expirations;
+      due = (uint16_t) (count - channel->handled);
+
+      if ((due != 0u) && (channel->callback != NULL_PTR))
       {
-        channel->callback();
-        channel->expired = FALSE;
+        generation = channel->generation;
+        channel->handled = count;
+
+        if (channel->statistics != NULL_PTR)
+        {
+          /* The oldest handled expiry started its tick at tick * period */
+          start = SysTimerIf_GetTimestamp();
+          SysTimerIf_Measure(&channel->statistics->delay, start
+            - ((channel->expiredTick - ((uint32_t) (due - 1u) * channel->reload))
+              * (SysTimerIf_reload + 1u)));
+        }
+
+        /* Drop the periods which cannot be caught up */
+        if (due > SysTimerIf_userCfg->maxCatchUp)
+        {
+          channel->missed += (uint32_t) (due - SysTimerIf_userCfg->maxCatchUp);
+          due = SysTimerIf_userCfg->maxCatchUp;
+        }
+
+        /* Stop catching up if the callback stopped the channel */
+        while (due != 0u)
+        {
+          if (channel->statistics != NULL_PTR)
+          {
+            start = SysTimerIf_GetTimestamp();
+            channel->callback();
+            SysTimerIf_Measure(&channel->statistics->duration,
+                               SysTimerIf_GetTimestamp() - start);
+          }
+          else
+          {
+            channel->callback();
+          }
+          due--;
+          if (!channel->isActivated)
+          {
+            break;
+          }
+        }
+
+        /* Expired one-shot pool timers are freed, unless the callback
+         * already cancelled the timer */
+        if ((i >= SysTimerIf_userCfg->numberOfChannels)
+          && !channel->isActivated && (channel->callback != NULL_PTR)
+          && (channel->generation == generation))
+        {
+          /* Enter the Critical Section. */
+          SYSTIMERIF_ENTER_CS();
+          SysTimerIf_Free(i);
+          /* Leave the Critical Section. */
+          SYSTIMERIF_LEAVE_CS();
+        }
       }
     }
-    /* Leave the Critical Section. */
-    SYSTIMERIF_LEAVE_CS();
   }
 }
 
@@ -117,10 +245,16 @@ void SysTimerIf_Start(const uint8_t channel, const uint32_t timeout)
 
     if (userCfg != NULL_PTR)
     {
+      if (userCfg->isActivated)
+      {
+        SysTimerIf_WheelRemove(channel);
+      }
       userCfg->isActivated = TRUE;
       userCfg->timeout = timeout;
-      userCfg->reload = timeout;
-      userCfg->expired = FALSE;
+      userCfg->reload = (timeout != 0u) ? timeout : 1u;
+      userCfg->handled = userCfg->expirations;
+      userCfg->expiry = SysTimerIf_ticks + userCfg->reload;
+      SysTimerIf_WheelInsert(channel);
     }
     /* Leave the Critical Section. */
     SYSTIMERIF_LEAVE_CS();
@@ -144,13 +278,279 @@ void SysTimerIf_Stop(const uint8_t channel)
 
     if (userCfg != NULL_PTR)
     {
+      if (userCfg->isActivated)
+      {
+        SysTimerIf_WheelRemove(channel);
+      }
       userCfg->isActivated = FALSE;
       userCfg->timeout = 0;
-      userCfg->expired = FALSE;
+      userCfg->handled = userCfg->expirations;
+    }
+    /* Leave the Critical Section. */
+    SYSTIMERIF_LEAVE_CS();
+  }
+}
+
+uint32_t SysTimerIf_GetTimestamp(void)
+{
+  /* Local variables */
+  uint32_t ticks;
+  uint32_t value;
+  uint32_t reload;
+  BOOL pending;
+
+  /* Initialize local variables */
+  /* Not SysTick->LOAD: after tickless idle the rest of a tick is counted
+   * with a smaller reload value */
+  reload = SysTimerIf_reload;
+
+  /* Retry if the interrupt counted in between */
+  do
+  {
+    ticks = SysTimerIf_ticks;
+    value = SysTick->VAL;
+    pending = (BOOL) ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0u);
+  } while (ticks != SysTimerIf_ticks);
+
+  /* Called with the SysTick interrupt blocked: the counter wrapped before
+   * the value was read if it is pending and the value was just reloaded */
+  if (pending && (value > (reload / 2u)))
+  {
+    ticks++;
+  }
+
+  return (ticks * (reload + 1u)) + (reload - value);
+}
+
+uint32_t SysTimerIf_GetTicks(void)
+{
+  return SysTimerIf_ticks;
+}
+
+void SysTimerIf_Idle(void)
+{
+  /* Local variables */
+  uint32_t primask;
+  uint32_t idleTicks;
+  uint32_t period;
+  uint32_t remaining;
+  uint32_t ctrl;
+
+  /* Initialize local variables */
+  period = SysTimerIf_reload + 1u;
+
+  /* WFI wakes up on pending interrupts with PRIMASK set, they are handled
+   * after SysTick was resynchronized */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if ((SysTimerIf_userCfg != NULL_PTR) && SysTimerIf_userCfg->tickless)
+  {
+    idleTicks = SysTimerIf_GetIdleTicks(SysTick_LOAD_RELOAD_Msk / period);
+  }
+  else
+  {
+    idleTicks = 1u;
+  }
+
+  if (idleTicks == 1u)
+  {
+    __WFI();
+  }
+  else if (idleTicks > 1u)
+  {
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+    /* A tick passed since the idle ticks were calculated */
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0u)
+    {
+      SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    }
+    else
+    {
+      /* Rest of this tick and the further ticks until the expiry */
+      SysTick->LOAD = SysTick->VAL + ((idleTicks - 1u) * period);
+      SysTick->VAL = 0u;
+      SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+      __DSB();
+      __WFI();
+
+      ctrl = SysTick->CTRL;
+      SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+
+      if ((ctrl & SysTick_CTRL_COUNTFLAG_Msk) != 0u)
+      {
+        /* Expiry reached, the pending interrupt counts its tick. Finish the
+         * tick the counter is already in */
+        SysTimerIf_ticks += idleTicks - 1u;
+        remaining = SysTick->LOAD - SysTick->VAL;
+        remaining = (remaining < SysTimerIf_reload) ? (SysTimerIf_reload - remaining) : SysTimerIf_reload;
+      }
+      else
+      {
+        /* Woken up early: count the passed ticks, the counter runs on to
+         * the next tick boundary */
+        remaining = SysTick->VAL;
+        SysTimerIf_ticks += (idleTicks - 1u) - ((remaining - 1u) / period);
+        remaining = (remaining - 1u) % period;
+      }
+
+      SysTick->LOAD = (remaining != 0u) ? remaining : 1u;
+      SysTick->VAL = 0u;
+      SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+      /* Takes effect at the next reload */
+      SysTick->LOAD = SysTimerIf_reload;
+    }
+  }
+  else
+  {
+    /* Callbacks are pending */
+  }
+
+  __set_PRIMASK(primask);
+}
+
+uint32_t SysTimerIf_GetMissed(const uint8_t channel)
+{
+  /* Local variables */
+  uint32_t ret;
+
+  /* Initialize local variables */
+  ret = 0u;
+
+  if (SysTimerIf_userCfg != NULL_PTR
+    && channel < SysTimerIf_userCfg->numberOfChannels)
+  {
+    ret = SysTimerIf_userCfg->channelConfigs[channel].missed;
+  }
+
+  return ret;
+}
+
+const SysTimerIf_StatisticsType* SysTimerIf_GetStatistics(const uint8_t channel)
+{
+  /* Local variables */
+  const SysTimerIf_StatisticsType* ret;
+
+  /* Initialize local variables */
+  ret = NULL_PTR;
+
+  if (SysTimerIf_userCfg != NULL_PTR
+    && channel < SysTimerIf_userCfg->numberOfChannels)
+  {
+    ret = SysTimerIf_userCfg->channelConfigs[channel].statistics;
+  }
+
+  return ret;
+}
+
+void SysTimerIf_ResetStatistics(const uint8_t channel)
+{
+  /* Local variables */
+  SysTimerIf_StatisticsType* statistics;
+
+  /* Initialize local variables */
+  statistics = NULL_PTR;
+
+  if (SysTimerIf_userCfg != NULL_PTR
+    && channel < SysTimerIf_userCfg->numberOfChannels)
+  {
+    statistics = SysTimerIf_userCfg->channelConfigs[channel].statistics;
+    if (statistics != NULL_PTR)
+    {
+      memset(statistics, 0, sizeof(SysTimerIf_StatisticsType));
+    }
+  }
+}
+
+uint32_t SysTimerIf_GetMean(const SysTimerIf_MeasurementType* measurement)
+{
+  /* Local variables */
+  uint32_t ret;
+
+  /* Initialize local variables */
+  ret = 0u;
+
+  if ((measurement != NULL_PTR) && (measurement->count != 0u))
+  {
+    ret = (uint32_t) (measurement->sum / measurement->count);
+  }
+
+  return ret;
+}
+
+SysTimerIf_HandleType SysTimerIf_Create(SysTimerIf_CallbackType callback,
+                                        const uint32_t timeout,
+                                        const uint32_t period)
+{
+  /* Local variables */
+  SysTimerIf_HandleType ret;
+  uint8_t i;
+  SysTimerIf_ChannelConfigType* channel;
+
+  /* Initialize local variables */
+  ret = SYSTIMERIF_INVALID_HANDLE;
+
+  if ((SysTimerIf_userCfg != NULL_PTR) && (callback != NULL_PTR))
+  {
+    /* Enter the Critical Section. */
+    SYSTIMERIF_ENTER_CS();
+    for (i = SysTimerIf_userCfg->numberOfChannels; i < (SysTimerIf_userCfg->numberOfChannels
+      + SysTimerIf_userCfg->poolSize); i++)
+    {
+      channel = &SysTimerIf_userCfg->channelConfigs[i];
+      if (channel->callback == NULL_PTR)
+      {
+        channel->callback = callback;
+        channel->timeout = timeout;
+        channel->reload = period;
+        channel->handled = channel->expirations;
+        channel->isActivated = TRUE;
+        channel->expiry = SysTimerIf_ticks + ((timeout != 0u) ? timeout : 1u);
+        SysTimerIf_WheelInsert(i);
+
+        ret = (SysTimerIf_HandleType) (((uint16_t) channel->generation << 8u) | i);
+        break;
+      }
     }
     /* Leave the Critical Section. */
     SYSTIMERIF_LEAVE_CS();
   }
+
+  return ret;
+}
+
+BOOL SysTimerIf_Cancel(const SysTimerIf_HandleType handle)
+{
+  /* Local variables */
+  BOOL ret;
+  uint8_t channel;
+
+  /* Initialize local variables */
+  ret = FALSE;
+
+  if (SysTimerIf_userCfg != NULL_PTR)
+  {
+    /* Enter the Critical Section. */
+    SYSTIMERIF_ENTER_CS();
+    channel = SysTimerIf_GetPoolChannel(handle);
+    if (channel != SYSTIMERIF_CHANNEL_NONE)
+    {
+      SysTimerIf_Free(channel);
+      ret = TRUE;
+    }
+    /* Leave the Critical Section. */
+    SYSTIMERIF_LEAVE_CS();
+  }
+
+  return ret;
+}
+
+BOOL SysTimerIf_IsValid(const SysTimerIf_HandleType handle)
+{
+  return (BOOL) ((SysTimerIf_userCfg != NULL_PTR)
+    && (SysTimerIf_GetPoolChannel(handle) != SYSTIMERIF_CHANNEL_NONE));
 }
 
 void SysTimerIf_SetCallback(const uint8_t channel, SysTimerIf_CallbackType callback)
@@ -170,27 +570,68 @@ void SysTimerIf_Isr(void)
 {
   /* Local variables */
   uint8_t i;
+  uint8_t next;
+  uint8_t expiredList;
+  uint8_t* link;
   SysTimerIf_ChannelConfigType* channel;
 
   /* Initialize local variables */
-  i = 0u;
-  channel = NULL_PTR;
+  expiredList = SYSTIMERIF_CHANNEL_NONE;
+
+  SysTimerIf_ticks++;
 
   if (SysTimerIf_userCfg != NULL_PTR)
   {
-    for (i = 0u; i < SysTimerIf_userCfg->numberOfChannels; i++)
+    /* Only the slot of this tick is visited; channels of later wheel
+     * rounds stay in it */
+    link = &SysTimerIf_userCfg->wheel[SysTimerIf_ticks
+      & (SysTimerIf_userCfg->wheelSize - 1u)];
+    i = *link;
+
+    while (i != SYSTIMERIF_CHANNEL_NONE)
     {
       channel = &SysTimerIf_userCfg->channelConfigs[i];
-      if (channel->isActivated)
+      next = channel->next;
+
+      if (channel->expiry == SysTimerIf_ticks)
       {
-        channel->timeout--;
-        /* Time has expired. */
-        if (channel->timeout == 0)
-        {
-          channel->expired = TRUE;
-          /* Reload timer with default value. */
-          channel->timeout = channel->reload;
-        }
+        /* Move to the expired list */
+        *link = next;
+        channel->next = expiredList;
+        expiredList = i;
+      }
+      else
+      {
+        link = &channel->next;
+      }
+      i = next;
+    }
+
+    if ((expiredList != SYSTIMERIF_CHANNEL_NONE)
+      && (SysTimerIf_userCfg->expiryNotifier != NULL_PTR))
+    {
+      SysTimerIf_userCfg->expiryNotifier();
+    }
+
+    /* Time has expired, reload and sort in again */
+    while (expiredList != SYSTIMERIF_CHANNEL_NONE)
+    {
+      i = expiredList;
+      channel = &SysTimerIf_userCfg->channelConfigs[i];
+      expiredList = channel->next;
+
+      channel->expirations++;
+      channel->expiredTick = SysTimerIf_ticks;
+
+      /* One-shot timers leave the wheel */
+      if (channel->reload != 0u)
+      {
+        channel->expiry += channel->reload;
+        SysTimerIf_WheelInsert(i);
+      }
+      else
+      {
+        channel->isActivated = FALSE;
       }
     }
   }
@@ -200,3 +641,146 @@ void SysTimerIf_Isr(void)
  * Static functions
  ***************************************************************/
 
+static void SysTimerIf_WheelInsert(const uint8_t channel)
+{
+  /* Local variables */
+  uint8_t* slot;
+  SysTimerIf_ChannelConfigType* channelConfig;
+
+  /* Initialize local variables */
+  channelConfig = &SysTimerIf_userCfg->channelConfigs[channel];
+  slot = &SysTimerIf_userCfg->wheel[channelConfig->expiry
+    & (SysTimerIf_userCfg->wheelSize - 1u)];
+
+  channelConfig->next = *slot;
+  *slot = channel;
+}
+
+static uint8_t SysTimerIf_GetPoolChannel(const SysTimerIf_HandleType handle)
+{
+  /* Local variables */
+  uint8_t ret;
+  uint8_t channel;
+
+  /* Initialize local variables */
+  ret = SYSTIMERIF_CHANNEL_NONE;
+  channel = (uint8_t) (handle & 0xFFu);
+
+  if ((channel >= SysTimerIf_userCfg->numberOfChannels)
+    && (channel < (SysTimerIf_userCfg->numberOfChannels + SysTimerIf_userCfg->poolSize))
+    && (SysTimerIf_userCfg->channelConfigs[channel].callback != NULL_PTR)
+    && (SysTimerIf_userCfg->channelConfigs[channel].generation == (uint8_t) (handle >> 8u)))
+  {
+    ret = channel;
+  }
+
+  return ret;
+}
+
+static void SysTimerIf_Free(const uint8_t channel)
+{
+  /* Local variables */
+  SysTimerIf_ChannelConfigType* channelConfig;
+
+  /* Initialize local variables */
+  channelConfig = &SysTimerIf_userCfg->channelConfigs[channel];
+
+  if (channelConfig->isActivated)
+  {
+    SysTimerIf_WheelRemove(channel);
+  }
+  channelConfig->isActivated = FALSE;
+  channelConfig->handled = channelConfig->expirations;
+  channelConfig->callback = NULL_PTR;
+  channelConfig->generation++;
+}
+
+static uint32_t SysTimerIf_GetIdleTicks(const uint32_t maxTicks)
+{
+  /* Local variables */
+  uint32_t ret;
+  uint32_t ticks;
+  uint8_t i;
+  SysTimerIf_ChannelConfigType* channel;
+
+  /* Initialize local variables */
+  ret = maxTicks;
+
+  for (i = 0u; i < (SysTimerIf_userCfg->numberOfChannels
+    + SysTimerIf_userCfg->poolSize); i++)
+  {
+    channel = &SysTimerIf_userCfg->channelConfigs[i];
+    if (channel->expirations != channel->handled)
+    {
+      ret = 0u;
+      break;
+    }
+    if (channel->isActivated)
+    {
+      ticks = channel->expiry - SysTimerIf_ticks;
+      if (ticks < ret)
+      {
+        ret = ticks;
+      }
+    }
+  }
+
+  return ret;
+}
+
+static void SysTimerIf_Measure(SysTimerIf_MeasurementType* measurement,
+                               const uint32_t value)
+{
+  /* Local variables */
+  uint8_t bin;
+  uint32_t scaled;
+
+  /* Initialize local variables */
+  bin = 0u;
+  scaled = value >> SYSTIMERIF_HISTOGRAM_SHIFT;
+
+  if ((measurement->count == 0u) || (value < measurement->min))
+  {
+    measurement->min = value;
+  }
+  if (value > measurement->max)
+  {
+    measurement->max = value;
+  }
+  measurement->sum += value;
+  measurement->count++;
+
+  /* Bin of the highest set bit */
+  while ((scaled > 1u) && (bin < (SYSTIMERIF_HISTOGRAM_BINS - 1u)))
+  {
+    scaled >>= 1u;
+    bin++;
+  }
+  if (measurement->histogram[bin] != 0xFFFFu)
+  {
+    measurement->histogram[bin]++;
+  }
+}
+
+static void SysTimerIf_WheelRemove(const uint8_t channel)
+{
+  /* Local variables */
+  uint8_t* link;
+  SysTimerIf_ChannelConfigType* channelConfig;
+
+  /* Initialize local variables */
+  channelConfig = &SysTimerIf_userCfg->channelConfigs[channel];
+  link = &SysTimerIf_userCfg->wheel[channelConfig->expiry
+    & (SysTimerIf_userCfg->wheelSize - 1u)];
+
+  while (*link != SYSTIMERIF_CHANNEL_NONE)
+  {
+    if (*link == channel)
+    {
+      *link = channelConfig->next;
+      break;
+    }
+    link = &SysTimerIf_userCfg->channelConfigs[*link].next;
+  }
+}
+
@@ -20,11 +20,56 @@
  * Type definitions
  ***************************************************************/
 
+/* Histogram bin 0 counts values below 2^(SHIFT + 1) cycles, bin n > 0
+ * values of 2^(n + SHIFT) ... 2^(n + SHIFT + 1) - 1, the last bin also all
+ * larger values */
+#define SYSTIMERIF_HISTOGRAM_BINS       16u
+#define SYSTIMERIF_HISTOGRAM_SHIFT      8u
+
 /**
  * Represents the Callback type.
  */
 typedef void (*SysTimerIf_CallbackType)(void);
 
+/**
+ * Represents the notification type, called by the ISR.
+ */
+typedef void (*SysTimerIf_NotifyType)(void);
+
+/**
+ * Handle of a timer created at runtime: generation (upper byte) and
+ *  channel (lower byte). A handle becomes invalid when its timer is freed.
+ */
+typedef uint16_t SysTimerIf_HandleType;
+
+/**
+ * Measured values in SysTick cycles (HCLK), the mean is sum / count.
+ */
+typedef struct
+{
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t sum;
+  uint16_t histogram[SYSTIMERIF_HISTOGRAM_BINS];
+} SysTimerIf_MeasurementType;
+
+/**
+ * Timing statistics of one channel.
+ */
+typedef struct
+{
+  /**
+   * Time from the expiry tick to the callback start. If the main function
+   *  fell behind, from the oldest handled expiry.
+   */
+  SysTimerIf_MeasurementType delay;
+  /**
+   * Run time of the callback.
+   */
+  SysTimerIf_MeasurementType duration;
+} SysTimerIf_StatisticsType;
+
 /**
  * Defines one channel.
  */
@@ -34,7 +79,34 @@ typedef struct
   uint32_t timeout;
   uint32_t reload;
   BOOL isActivated;
-  BOOL expired;
+  /**
+   * Expirations counted by the ISR and expirations handled by the main
+   *  function. Only the ISR writes expirations and only the main function
+   *  writes handled, so neither has to lock the other out.
+   */
+  volatile uint16_t expirations;
+  uint16_t handled;
+  /**
+   * Expirations dropped since initialization, because the main function
+   *  fell more than maxCatchUp periods behind.
+   */
+  uint32_t missed;
+  /**
+   * Tick of the next expiry and next channel in the same wheel slot,
+   *  maintained by SysTimerIf.
+   */
+  uint32_t expiry;
+  uint8_t next;
+  /**
+   * Incremented whenever a pool timer is freed, invalidates old handles.
+   */
+  uint8_t generation;
+  /**
+   * Optional timing statistics, NULL_PTR if unused, and tick of the last
+   *  expiry.
+   */
+  SysTimerIf_StatisticsType* statistics;
+  uint32_t expiredTick;
 } SysTimerIf_ChannelConfigType;
 
 /**
@@ -45,8 +117,47 @@ typedef struct
   const uint8_t numberOfChannels;
   SysTimerIf_ChannelConfigType* channelConfigs;
   const uint32_t timeResolution;
+  /**
+   * Timing wheel: slot (tick % wheelSize) lists the channels which may
+   *  expire at that tick. wheelSize has to be a power of 2.
+   */
+  uint8_t* const wheel;
+  const uint8_t wheelSize;
+  /**
+   * Number of timers allocated at runtime. Their channels follow the
+   *  compile time channels in channelConfigs, a free one has no callback.
+   */
+  const uint8_t poolSize;
+  /**
+   * Maximum number of callbacks per channel and main function call, which
+   *  catch up on expirations the main function fell behind.
+   */
+  const uint8_t maxCatchUp;
+  /**
+   * Let SysTimerIf_Idle stop the tick until the next expiry.
+   */
+  const BOOL tickless;
+  /**
+   * Optional notification if channels expired, NULL_PTR if the main
+   *  function is called cyclically.
+   */
+  const SysTimerIf_NotifyType expiryNotifier;
 } SysTimerIf_ConfigType;
 
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+/**
+ * Marks the end of a wheel slot list.
+ */
+#define SYSTIMERIF_CHANNEL_NONE         0xFFu
+
+/**
+ * Returned if no timer could be created.
+ */
+#define SYSTIMERIF_INVALID_HANDLE       0xFFFFu
+
 /****************************************************************
  * Global variables
  ***************************************************************/
@@ -84,11 +195,88 @@ void SysTimerIf_Start(const uint8_t channel, const uint32_t timeout);
  */
 void SysTimerIf_Stop(const uint8_t channel);
 
+/**
+ * Gets the number of ticks since initialization, which stays accurate
+ *  across tickless idle periods.
+ * @return The tick counter.
+ */
+uint32_t SysTimerIf_GetTicks(void);
+
+/**
+ * Sleeps (WFI) until the next interrupt. In tickless mode SysTick is
+ *  reprogrammed to wake up at the next expiry instead of every tick and the
+ *  skipped ticks are added on wake up. Call from the main loop, after
+ *  SysTimerIf_MainFunction, if there is nothing else to do.
+ */
+void SysTimerIf_Idle(void);
+
+/**
+ * Gets the number of expirations of a channel which were dropped instead
+ *  of calling the callback.
+ * @param channel The channel.
+ * @return The number of missed periods since initialization.
+ */
+uint32_t SysTimerIf_GetMissed(const uint8_t channel);
+
+/**
+ * Gets the timing statistics of a channel.
+ * @param channel The channel.
+ * @return The statistics, NULL_PTR if the channel has none.
+ */
+const SysTimerIf_StatisticsType* SysTimerIf_GetStatistics(const uint8_t channel);
+
+/**
+ * Clears the timing statistics of a channel.
+ * @param channel The channel.
+ */
+void SysTimerIf_ResetStatistics(const uint8_t channel);
+
+/**
+ * Gets the mean of a measurement.
+ * @param measurement The measurement.
+ * @return The mean in cycles, 0 if nothing was measured.
+ */
+uint32_t SysTimerIf_GetMean(const SysTimerIf_MeasurementType* measurement);
+
+/**
+ * Creates a timer from the pool and starts it. Call from the main loop only.
+ * @param callback The callback, called by SysTimerIf_MainFunction.
+ * @param timeout The time until the first expiry.
+ * @param period The period after the first expiry, 0 for a one-shot timer.
+ *  One-shot timers are freed after their callback.
+ * @return The handle, SYSTIMERIF_INVALID_HANDLE if the pool is empty.
+ */
+SysTimerIf_HandleType SysTimerIf_Create(SysTimerIf_CallbackType callback,
+                                        const uint32_t timeout,
+                                        const uint32_t period);
+
+/**
+ * Stops and frees a timer created at runtime. Call from the main loop only.
+ * @param handle The handle of the timer.
+ * @return TRUE if the timer was freed; FALSE if the handle was invalid
+ *  (e.g. the one-shot timer already expired).
+ */
+BOOL SysTimerIf_Cancel(const SysTimerIf_HandleType handle);
+
+/**
+ * Checks if a timer created at runtime is still allocated.
+ * @param handle The handle of the timer.
+ * @return TRUE if the handle is valid; otherwise FALSE.
+ */
+BOOL SysTimerIf_IsValid(const SysTimerIf_HandleType handle);
+
 /**
  * The Timer ISR Function
  */
 void SysTimerIf_Isr(void);
 
+/**
+ * Gets a free running timestamp in core clock cycles, may be called from
+ *  interrupts. Differences are valid for 2^32 cycles (89 s at 48 MHz).
+ * @return The timestamp.
+ */
+uint32_t SysTimerIf_GetTimestamp(void);
+
 /**
  * Sets the callback function for TimerIf_userCfg->channelConfigs[channel].callback
  * @param the used channel
@@ -15,9 +15,10 @@
 #include "SysTimerIf_Cfg.h"
 
 /* callbacks */
-#include "Stopwatch.h"
-#include "BSP/Led.h"
-#include "SysState.h"
+#include "BSP/Debounce.h"
+#include "BSP/Debounce_Cfg.h"
+#include "Services/Scheduler_Cfg.h"
+#include "Services/SysState.h"
 
 /****************************************************************
  * Type definitions
@@ -36,38 +37,54 @@
  ***************************************************************/
 
 /**
- * Defines the SysTimerIf_ChannelConfigType.
+ * Timing statistics of the channels.
  */
-static SysTimerIf_ChannelConfigType SysTimerIf_channelConfigs[SYSTIMERIF_NUMBER_OF_CHANNELS] =
+static SysTimerIf_StatisticsType SysTimerIf_statistics0;
+static SysTimerIf_StatisticsType SysTimerIf_statistics1;
+
+/**
+ * Defines the SysTimerIf_ChannelConfigType. The pool channels follow, they
+ * are zero initialized (free).
+ */
+static SysTimerIf_ChannelConfigType SysTimerIf_channelConfigs[SYSTIMERIF_NUMBER_OF_CHANNELS
+  + SYSTIMERIF_POOL_SIZE] =
 {
   {
     SYSTIMERIF_CALLBACK0,
     SYSTIMERIF_TIMEOUT0,
     SYSTIMERIF_TIMEOUT0,
     SYSTIMERIF_ACTIVATED0,
-    FALSE
+    0u, 0u, 0u,
+    0u, SYSTIMERIF_CHANNEL_NONE, 0u,
+    SYSTIMERIF_STATISTICS0, 0u
   },
   {
     SYSTIMERIF_CALLBACK1,
     SYSTIMERIF_TIMEOUT1,
     SYSTIMERIF_TIMEOUT1,
     SYSTIMERIF_ACTIVATED1,
-    FALSE
-  },
-  {
-    SYSTIMERIF_CALLBACK2,
-    SYSTIMERIF_TIMEOUT2,
-    SYSTIMERIF_TIMEOUT2,
-    SYSTIMERIF_ACTIVATED2,
-    FALSE
+    0u, 0u, 0u,
+    0u, SYSTIMERIF_CHANNEL_NONE, 0u,
+    SYSTIMERIF_STATISTICS1, 0u
   }
 };
 
+/**
+ * Timing wheel slots.
+ */
+static uint8_t SysTimerIf_wheel[SYSTIMERIF_WHEEL_SIZE];
+
 SysTimerIf_ConfigType SysTimerIf_config =
 {
   SYSTIMERIF_NUMBER_OF_CHANNELS,
   SysTimerIf_channelConfigs,
-  SYSTIMERIF_RESOLUTION
+  SYSTIMERIF_RESOLUTION,
+  SysTimerIf_wheel,
+  SYSTIMERIF_WHEEL_SIZE,
+  SYSTIMERIF_POOL_SIZE,
+  SYSTIMERIF_MAX_CATCH_UP,
+  SYSTIMERIF_TICKLESS,
+  SYSTIMERIF_EXPIRY_NOTIFIER
 };
 
 /****************************************************************
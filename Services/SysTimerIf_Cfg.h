@@ -17,23 +17,25 @@
 #include "Services/StdDef.h"
 
 /* Generic */
-#define SYSTIMERIF_NUMBER_OF_CHANNELS   3u
+#define SYSTIMERIF_NUMBER_OF_CHANNELS   2u
 #define SYSTIMERIF_RESOLUTION           1000u     /* for Milliseconds tick */
+#define SYSTIMERIF_WHEEL_SIZE           16u       /* power of 2 */
+#define SYSTIMERIF_POOL_SIZE            8u        /* timers created at runtime */
+#define SYSTIMERIF_MAX_CATCH_UP         4u        /* callbacks per channel and main function call */
+#define SYSTIMERIF_TICKLESS             TRUE      /* stop the tick in SysTimerIf_Idle */
+#define SYSTIMERIF_EXPIRY_NOTIFIER      Scheduler_SysTimerNotification
 
 /* Channel 0 */
-#define SYSTIMERIF_CALLBACK0            Stopwatch_MsTimer
-#define SYSTIMERIF_TIMEOUT0             1u        /* in ms */
-#define SYSTIMERIF_ACTIVATED0           TRUE
-
-/* Channel 1 */
-#define SYSTIMERIF_CALLBACK1            Led_MsTimer
-#define SYSTIMERIF_TIMEOUT1             1u        /* in ms */
+#define SYSTIMERIF_CALLBACK0            Debounce_MsTimer
+#define SYSTIMERIF_TIMEOUT0             5u        /* in ms, debounce sample period */
+#define SYSTIMERIF_ACTIVATED0           (DEBOUNCE_NUMBER_OF_PORTS > 0u)   /* no sampling without ports */
+#define SYSTIMERIF_STATISTICS0          &SysTimerIf_statistics0   /* or NULL_PTR */
+
+/* Channel 1, restarted by SysState for the next fall back */
+#define SYSTIMERIF_CALLBACK1            SysState_FallBackTimer
+#define SYSTIMERIF_TIMEOUT1             1u        /* in ms, SysState stops it if nothing is pending */
 #define SYSTIMERIF_ACTIVATED1           TRUE
-
-/* Channel 2 */
-#define SYSTIMERIF_CALLBACK2            SysState_MsTimer
-#define SYSTIMERIF_TIMEOUT2             1u        /* in ms */
-#define SYSTIMERIF_ACTIVATED2           TRUE
+#define SYSTIMERIF_STATISTICS1          &SysTimerIf_statistics1   /* or NULL_PTR */
 
 #endif
 
@@ -0,0 +1,327 @@
+/**
+ ******************************************************************************
+ * @file    Coroutine_Test.c
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Host test of the Coroutine macros and their timer wake ups.
+ *
+ * SysTimerIf is replaced by a small pool of one-shot timers, which are
+ * freed after their callback like the SysTimerIf pool. The test coroutine
+ * passes each wait once and records its progress, the owner posts events
+ * and calls it again.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+
+#include "Services/Coroutine.h"
+#include "Services/SysTimerIf.h"
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+#define TEST_POOL_SIZE                    2u
+#define TEST_EVENT_RX                     0x01u
+#define TEST_EVENT_OTHER                  0x02u
+#define TEST_TIMEOUT                      10u
+
+#define TEST_CHECK(condition)                                               \
+  do                                                                        \
+  {                                                                         \
+    if (!(condition))                                                       \
+    {                                                                       \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition);           \
+      Test_failures++;                                                      \
+    }                                                                       \
+  } while (0)
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+/* Progress of the test coroutine */
+typedef enum
+{
+  Test_StepNone = 0u,
+  Test_StepStarted,
+  Test_StepYielded,
+  Test_StepEvent,
+  Test_StepCondition,
+  Test_StepTimedOut,
+  Test_StepEnd
+} Test_StepType;
+
+typedef struct
+{
+  SysTimerIf_CallbackType callback;
+  uint32_t expiry;
+  uint8_t generation;
+} Test_TimerType;
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+static int Test_failures;
+static uint32_t Test_ticks;
+static uint32_t Test_wakes;
+static Test_TimerType Test_timers[TEST_POOL_SIZE];
+
+static Test_StepType Test_step;
+static BOOL Test_condition;
+static BOOL Test_restart;
+
+static void Test_Wake(void);
+
+static Coroutine_ContextType Test_ctx = COROUTINE_CONTEXT_INIT(Test_Wake);
+
+/****************************************************************
+ * Stand-ins of the used modules
+ ***************************************************************/
+
+uint32_t SysTimerIf_GetTicks(void)
+{
+  return Test_ticks;
+}
+
+/* Handles carry the generation of the timer, like the SysTimerIf pool */
+SysTimerIf_HandleType SysTimerIf_Create(SysTimerIf_CallbackType callback,
+  const uint32_t timeout, const uint32_t period)
+{
+  SysTimerIf_HandleType handle;
+  uint8_t i;
+
+  handle = SYSTIMERIF_INVALID_HANDLE;
+  for (i = 0u; (i < TEST_POOL_SIZE) && (handle == SYSTIMERIF_INVALID_HANDLE); i++)
+  {
+    if ((Test_timers[i].callback == NULL_PTR) && (callback != NULL_PTR) && (period == 0u))
+    {
+      Test_timers[i].callback = callback;
+      Test_timers[i].expiry = Test_ticks + timeout;
+      handle = (SysTimerIf_HandleType) (((uint16_t) Test_timers[i].generation << 8) | (i + 1u));
+    }
+  }
+
+  return handle;
+}
+
+static Test_TimerType* Test_GetTimer(const SysTimerIf_HandleType handle)
+{
+  Test_TimerType* timer;
+  uint8_t i;
+
+  timer = NULL_PTR;
+  i = (uint8_t) ((handle & 0xFFu) - 1u);
+  if ((i < TEST_POOL_SIZE) && (Test_timers[i].callback != NULL_PTR)
+    && (Test_timers[i].generation == (uint8_t) (handle >> 8)))
+  {
+    timer = &Test_timers[i];
+  }
+
+  return timer;
+}
+
+static void Test_FreeTimer(Test_TimerType* timer)
+{
+  timer->callback = NULL_PTR;
+  timer->generation++;
+}
+
+BOOL SysTimerIf_Cancel(const SysTimerIf_HandleType handle)
+{
+  Test_TimerType* timer;
+
+  timer = Test_GetTimer(handle);
+  if (timer != NULL_PTR)
+    Test_FreeTimer(timer);
+
+  return timer != NULL_PTR;
+}
+
+BOOL SysTimerIf_IsValid(const SysTimerIf_HandleType handle)
+{
+  return Test_GetTimer(handle) != NULL_PTR;
+}
+
+/****************************************************************
+ * Test functions
+ ***************************************************************/
+
+static void Test_Wake(void)
+{
+  Test_wakes++;
+}
+
+static uint8_t Test_GetTimersInUse(void)
+{
+  uint8_t count;
+  uint8_t i;
+
+  count = 0u;
+  for (i = 0u; i < TEST_POOL_SIZE; i++)
+  {
+    if (Test_timers[i].callback != NULL_PTR)
+      count++;
+  }
+
+  return count;
+}
+
+/* Advances the ticks, expired one-shot timers are freed after their callback */
+static void Test_Run(uint32_t ticks)
+{
+  SysTimerIf_CallbackType callback;
+  uint8_t i;
+
+  while (ticks > 0u)
+  {
+    Test_ticks++;
+    for (i = 0u; i < TEST_POOL_SIZE; i++)
+    {
+      if ((Test_timers[i].callback != NULL_PTR) && (Test_ticks == Test_timers[i].expiry))
+      {
+        callback = Test_timers[i].callback;
+        Test_FreeTimer(&Test_timers[i]);
+        callback();
+      }
+    }
+    ticks--;
+  }
+}
+
+static Coroutine_StateType Test_Coroutine(Coroutine_ContextType* ctx)
+{
+  COROUTINE_BEGIN(ctx);
+
+  Test_step = Test_StepStarted;
+  COROUTINE_YIELD(ctx);
+
+  Test_step = Test_StepYielded;
+  COROUTINE_AWAIT_EVENT(ctx, TEST_EVENT_RX);
+
+  Test_step = Test_StepEvent;
+  COROUTINE_AWAIT_TIMEOUT(ctx, Test_condition, TEST_TIMEOUT);
+
+  Test_step = COROUTINE_TIMED_OUT(ctx) ? Test_StepTimedOut : Test_StepCondition;
+  if (Test_restart)
+    COROUTINE_RESTART(ctx);
+  COROUTINE_YIELD(ctx);
+
+  Test_step = Test_StepEnd;
+  COROUTINE_END(ctx);
+}
+
+/* Runs the coroutine from the beginning into the timeout wait */
+static void Test_EnterTimeout(void)
+{
+  TEST_CHECK(Test_Coroutine(&Test_ctx) == Coroutine_Yielded);
+  TEST_CHECK(Test_step == Test_StepStarted);
+
+  /* Waits for its event, others stay posted */
+  Coroutine_PostEvents(&Test_ctx, TEST_EVENT_OTHER);
+  TEST_CHECK(Test_Coroutine(&Test_ctx) == Coroutine_Waiting);
+  TEST_CHECK(Test_step == Test_StepYielded);
+  TEST_CHECK(Test_Coroutine(&Test_ctx) == Coroutine_Waiting);
+
+  Coroutine_PostEvents(&Test_ctx, TEST_EVENT_RX);
+  TEST_CHECK(Test_Coroutine(&Test_ctx) == Coroutine_Waiting);
+  TEST_CHECK(Test_step == Test_StepEvent);
+  TEST_CHECK(!Coroutine_TakeEvents(&Test_ctx, TEST_EVENT_RX));
+  TEST_CHECK(Coroutine_TakeEvents(&Test_ctx, TEST_EVENT_OTHER));
+
+  /* The timeout holds a pool timer */
+  TEST_CHECK(Test_GetTimersInUse() == 1u);
+  TEST_CHECK(SysTimerIf_IsValid(Test_ctx.timer));
+}
+
+static void Test_Condition(void)
+{
+  Test_condition = FALSE;
+  Test_restart = FALSE;
+  Test_wakes = 0u;
+  Test_EnterTimeout();
+
+  /* Condition met before the timeout, the timer is cancelled */
+  Test_Run(TEST_TIMEOUT / 2u);
+  TEST_CHECK(Test_Coroutine(&Test_ctx) == Coroutine_Waiting);
+  Test_condition = TRUE;
+  TEST_CHECK(Test_Coroutine(&Test_ctx) == Coroutine_Yielded);
+  TEST_CHECK(Test_step == Test_StepCondition);
+  TEST_CHECK(!COROUTINE_TIMED_OUT(&Test_ctx));
+  TEST_CHECK(Test_GetTimersInUse() == 0u);
+  TEST_CHECK(Test_ctx.timer == SYSTIMERIF_INVALID_HANDLE);
+
+  /* A cancelled timer never wakes the owner */
+  Test_Run(TEST_TIMEOUT);
+  TEST_CHECK(Test_wakes == 0u);
+
+  TEST_CHECK(Test_Coroutine(&Test_ctx) == Coroutine_Ended);
+  TEST_CHECK(Test_step == Test_StepEnd);
+  TEST_CHECK(Test_ctx.line == 0u);
+}
+
+static void Test_TimedOut(void)
+{
+  Test_condition = FALSE;
+  Test_restart = FALSE;
+  Test_wakes = 0u;
+  Test_EnterTimeout();
+
+  /* Calls before the timeout keep waiting */
+  Test_Run(TEST_TIMEOUT - 1u);
+  TEST_CHECK(Test_wakes == 0u);
+  TEST_CHECK(Test_Coroutine(&Test_ctx) == Coroutine_Waiting);
+
+  /* The pool timer wakes the owner once and is freed */
+  Test_Run(1u);
+  TEST_CHECK(Test_wakes == 1u);
+  TEST_CHECK(Test_GetTimersInUse() == 0u);
+  TEST_CHECK(Test_Coroutine(&Test_ctx) == Coroutine_Yielded);
+  TEST_CHECK(Test_step == Test_StepTimedOut);
+  TEST_CHECK(COROUTINE_TIMED_OUT(&Test_ctx));
+  TEST_CHECK(Test_ctx.timer == SYSTIMERIF_INVALID_HANDLE);
+
+  TEST_CHECK(Test_Coroutine(&Test_ctx) == Coroutine_Ended);
+  TEST_CHECK(Test_step == Test_StepEnd);
+}
+
+static void Test_Restart(void)
+{
+  Test_condition = FALSE;
+  Test_restart = TRUE;
+  Test_EnterTimeout();
+
+  /* Restart after the wait, the next call starts at the beginning */
+  Test_condition = TRUE;
+  TEST_CHECK(Test_Coroutine(&Test_ctx) == Coroutine_Yielded);
+  TEST_CHECK(Test_step == Test_StepCondition);
+  TEST_CHECK(Test_ctx.line == 0u);
+  TEST_CHECK(Test_GetTimersInUse() == 0u);
+  TEST_CHECK(Test_Coroutine(&Test_ctx) == Coroutine_Yielded);
+  TEST_CHECK(Test_step == Test_StepStarted);
+
+  /* Reset during the timeout wait frees its timer */
+  Test_restart = FALSE;
+  Test_condition = FALSE;
+  Coroutine_Reset(&Test_ctx);
+  Test_EnterTimeout();
+  Coroutine_Reset(&Test_ctx);
+  TEST_CHECK(Test_GetTimersInUse() == 0u);
+  TEST_CHECK(Test_ctx.timer == SYSTIMERIF_INVALID_HANDLE);
+  TEST_CHECK(Test_ctx.line == 0u);
+}
+
+int main(void)
+{
+  Test_Condition();
+  Test_TimedOut();
+  Test_Restart();
+
+  printf("%s\n", (Test_failures == 0) ? "PASS" : "FAIL");
+  return (Test_failures == 0) ? 0 : 1;
+}
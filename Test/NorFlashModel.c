@@ -0,0 +1,272 @@
+/**
+ ******************************************************************************
+ * @file    NorFlashModel.c
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Host model of a serial NOR flash (JEDEC command set).
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#include "NorFlashModel.h"
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+#define NORFLASHMODEL_MAX_SIZE            0x40000u
+#define NORFLASHMODEL_MAX_PAGE_SIZE       256u
+
+/* Commands */
+#define NORFLASHMODEL_CMD_READ_ID         0x9Fu
+#define NORFLASHMODEL_CMD_READ            0x03u
+#define NORFLASHMODEL_CMD_FAST_READ       0x0Bu
+#define NORFLASHMODEL_CMD_WRITE_ENABLE    0x06u
+#define NORFLASHMODEL_CMD_PAGE_PROGRAM    0x02u
+#define NORFLASHMODEL_CMD_SECTOR_ERASE    0x20u
+#define NORFLASHMODEL_CMD_READ_STATUS     0x05u
+
+/* Status register */
+#define NORFLASHMODEL_STATUS_WIP          0x01u
+#define NORFLASHMODEL_STATUS_WEL          0x02u
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+static NorFlashModel_ConfigType NorFlashModel_config;
+static NorFlashModel_StatisticsType NorFlashModel_statistics;
+static uint8_t NorFlashModel_memory[NORFLASHMODEL_MAX_SIZE];
+
+/* Current transaction */
+static BOOL NorFlashModel_selected;
+static uint32_t NorFlashModel_index;
+static uint8_t NorFlashModel_command;
+static uint32_t NorFlashModel_address;
+static uint8_t NorFlashModel_pageLatch[NORFLASHMODEL_MAX_PAGE_SIZE];
+static uint32_t NorFlashModel_latched;
+
+/* Device state */
+static BOOL NorFlashModel_present;
+static BOOL NorFlashModel_stuck;
+static BOOL NorFlashModel_writeEnabled;
+static uint32_t NorFlashModel_busyTicks;
+static uint32_t NorFlashModel_pollsThisTick;
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+void NorFlashModel_Init(const NorFlashModel_ConfigType* config)
+{
+  uint32_t i;
+
+  NorFlashModel_config = *config;
+  if (NorFlashModel_config.size > NORFLASHMODEL_MAX_SIZE)
+    NorFlashModel_config.size = NORFLASHMODEL_MAX_SIZE;
+  if (NorFlashModel_config.pageSize > NORFLASHMODEL_MAX_PAGE_SIZE)
+    NorFlashModel_config.pageSize = NORFLASHMODEL_MAX_PAGE_SIZE;
+
+  for (i = 0u; i < NorFlashModel_config.size; i++)
+    NorFlashModel_memory[i] = 0xFFu;
+
+  NorFlashModel_statistics = (NorFlashModel_StatisticsType) { 0u, 0u, 0u, 0u, 0u };
+  NorFlashModel_selected = FALSE;
+  NorFlashModel_present = TRUE;
+  NorFlashModel_stuck = FALSE;
+  NorFlashModel_writeEnabled = FALSE;
+  NorFlashModel_busyTicks = 0u;
+  NorFlashModel_pollsThisTick = 0u;
+}
+
+void NorFlashModel_Select(void)
+{
+  NorFlashModel_selected = TRUE;
+  NorFlashModel_index = 0u;
+  NorFlashModel_command = 0u;
+  NorFlashModel_address = 0u;
+  NorFlashModel_latched = 0u;
+}
+
+uint8_t NorFlashModel_Exchange(uint8_t tx)
+{
+  uint8_t rx;
+  uint32_t column;
+
+  rx = 0xFFu;
+
+  if (NorFlashModel_selected && NorFlashModel_present)
+  {
+    if (NorFlashModel_index == 0u)
+    {
+      NorFlashModel_command = tx;
+
+      if (NorFlashModel_command == NORFLASHMODEL_CMD_READ_STATUS)
+      {
+        if (NorFlashModel_busyTicks > 0u)
+        {
+          NorFlashModel_statistics.busyPolls++;
+          NorFlashModel_pollsThisTick++;
+          if (NorFlashModel_pollsThisTick > NorFlashModel_statistics.maxPollsPerTick)
+            NorFlashModel_statistics.maxPollsPerTick = NorFlashModel_pollsThisTick;
+        }
+      }
+      else if (NorFlashModel_busyTicks > 0u)
+      {
+        /* Ignored by the flash */
+        NorFlashModel_statistics.violations++;
+        NorFlashModel_command = 0u;
+      }
+    }
+    else if (NorFlashModel_index <= 3u)
+    {
+      /* 24 bit address, MSB first (ID and status are answered right away) */
+      NorFlashModel_address = (NorFlashModel_address << 8) | tx;
+    }
+
+    switch (NorFlashModel_command)
+    {
+      case NORFLASHMODEL_CMD_READ_ID:
+        if ((NorFlashModel_index >= 1u) && (NorFlashModel_index <= 3u))
+          rx = (uint8_t) (NorFlashModel_config.jedecId >> (8u * (3u - NorFlashModel_index)));
+        break;
+
+      case NORFLASHMODEL_CMD_READ_STATUS:
+        if (NorFlashModel_index >= 1u)
+        {
+          rx = (uint8_t) (((NorFlashModel_busyTicks > 0u) ? NORFLASHMODEL_STATUS_WIP : 0u)
+            | (NorFlashModel_writeEnabled ? NORFLASHMODEL_STATUS_WEL : 0u));
+        }
+        break;
+
+      case NORFLASHMODEL_CMD_READ:
+      case NORFLASHMODEL_CMD_FAST_READ:
+        if (NorFlashModel_index >= ((NorFlashModel_command == NORFLASHMODEL_CMD_READ) ? 4u : 5u))
+        {
+          rx = NorFlashModel_memory[NorFlashModel_address % NorFlashModel_config.size];
+          NorFlashModel_address++;
+        }
+        break;
+
+      case NORFLASHMODEL_CMD_PAGE_PROGRAM:
+        if (NorFlashModel_index >= 4u)
+        {
+          /* Data wraps within the page, the last bytes win */
+          column = (NorFlashModel_address + NorFlashModel_latched) % NorFlashModel_config.pageSize;
+          NorFlashModel_pageLatch[column] = tx;
+          if (NorFlashModel_latched < NorFlashModel_config.pageSize)
+            NorFlashModel_latched++;
+        }
+        break;
+
+      case NORFLASHMODEL_CMD_WRITE_ENABLE:
+      case NORFLASHMODEL_CMD_SECTOR_ERASE:
+      case 0u:
+        break;
+
+      default:
+        if (NorFlashModel_index == 0u)
+          NorFlashModel_statistics.violations++;
+        break;
+    }
+
+    NorFlashModel_index++;
+  }
+
+  return rx;
+}
+
+void NorFlashModel_Deselect(void)
+{
+  uint32_t i;
+  uint32_t page;
+  uint32_t column;
+  uint32_t sector;
+
+  if (NorFlashModel_selected && NorFlashModel_present)
+  {
+    switch (NorFlashModel_command)
+    {
+      case NORFLASHMODEL_CMD_WRITE_ENABLE:
+        NorFlashModel_writeEnabled = TRUE;
+        break;
+
+      case NORFLASHMODEL_CMD_PAGE_PROGRAM:
+        if (!NorFlashModel_writeEnabled || (NorFlashModel_index < 5u))
+        {
+          NorFlashModel_statistics.violations++;
+        }
+        else
+        {
+          /* Program can only clear bits */
+          page = NorFlashModel_address - (NorFlashModel_address % NorFlashModel_config.pageSize);
+          for (i = 0u; i < NorFlashModel_latched; i++)
+          {
+            column = (NorFlashModel_address + i) % NorFlashModel_config.pageSize;
+            NorFlashModel_memory[(page + column) % NorFlashModel_config.size] &=
+              NorFlashModel_pageLatch[column];
+          }
+          NorFlashModel_statistics.programs++;
+          NorFlashModel_busyTicks = NorFlashModel_config.programTicks;
+        }
+        NorFlashModel_writeEnabled = FALSE;
+        break;
+
+      case NORFLASHMODEL_CMD_SECTOR_ERASE:
+        if (!NorFlashModel_writeEnabled || (NorFlashModel_index != 4u))
+        {
+          NorFlashModel_statistics.violations++;
+        }
+        else
+        {
+          sector = NorFlashModel_address - (NorFlashModel_address % NorFlashModel_config.sectorSize);
+          for (i = 0u; i < NorFlashModel_config.sectorSize; i++)
+            NorFlashModel_memory[(sector + i) % NorFlashModel_config.size] = 0xFFu;
+          NorFlashModel_statistics.erases++;
+          NorFlashModel_busyTicks = NorFlashModel_config.eraseTicks;
+        }
+        NorFlashModel_writeEnabled = FALSE;
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  NorFlashModel_selected = FALSE;
+}
+
+void NorFlashModel_Tick(void)
+{
+  if ((NorFlashModel_busyTicks > 0u) && !NorFlashModel_stuck)
+    NorFlashModel_busyTicks--;
+  NorFlashModel_pollsThisTick = 0u;
+}
+
+void NorFlashModel_SetPresent(BOOL present)
+{
+  NorFlashModel_present = present;
+}
+
+void NorFlashModel_SetStuck(BOOL stuck)
+{
+  NorFlashModel_stuck = stuck;
+}
+
+BOOL NorFlashModel_IsBusy(void)
+{
+  return NorFlashModel_busyTicks > 0u;
+}
+
+uint8_t* NorFlashModel_GetMemory(void)
+{
+  return NorFlashModel_memory;
+}
+
+const NorFlashModel_StatisticsType* NorFlashModel_GetStatistics(void)
+{
+  return &NorFlashModel_statistics;
+}
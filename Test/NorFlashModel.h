@@ -0,0 +1,120 @@
+/**
+ ******************************************************************************
+ * @file    NorFlashModel.h
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Host model of a serial NOR flash (JEDEC command set).
+ *
+ * Erase sets a sector to 0xFF, page program can only clear bits (AND) and
+ * wraps within the page. Program and erase keep the write in progress bit
+ * set for a number of ticks, while the flash ignores all commands except
+ * read status. Commands, which would be ignored by a real flash, are
+ * counted as violations.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#ifndef NORFLASHMODEL_H
+#define NORFLASHMODEL_H
+
+#include "Services/StdDef.h"
+
+/****************************************************************
+ * Type definitions
+ ***************************************************************/
+
+typedef struct
+{
+  uint32_t jedecId;
+  uint32_t size;
+  uint32_t sectorSize;
+  uint32_t pageSize;
+  /**
+   * Busy time of page program and sector erase in ticks.
+   */
+  uint32_t programTicks;
+  uint32_t eraseTicks;
+} NorFlashModel_ConfigType;
+
+typedef struct
+{
+  uint32_t programs;
+  uint32_t erases;
+  /**
+   * Status reads while busy and the maximum of them within one tick.
+   */
+  uint32_t busyPolls;
+  uint32_t maxPollsPerTick;
+  /**
+   * Commands while busy, program/erase without write enable, unknown
+   *  commands.
+   */
+  uint32_t violations;
+} NorFlashModel_StatisticsType;
+
+/****************************************************************
+ * User functions
+ ***************************************************************/
+
+/**
+ * Initialize the model, the memory is erased.
+ * @param config The flash geometry and timing.
+ */
+void NorFlashModel_Init(const NorFlashModel_ConfigType* config);
+
+/**
+ * Asserts CS, starts a command.
+ */
+void NorFlashModel_Select(void);
+
+/**
+ * Exchanges one byte while CS is asserted.
+ * @param tx The byte sent to the flash.
+ * @return The byte received from the flash.
+ */
+uint8_t NorFlashModel_Exchange(uint8_t tx);
+
+/**
+ * Releases CS, program and erase commands start with it.
+ */
+void NorFlashModel_Deselect(void);
+
+/**
+ * Advances the time of program and erase by one tick.
+ */
+void NorFlashModel_Tick(void);
+
+/**
+ * Makes the flash answer nothing (all bits set) or answer again.
+ * @param present FALSE to disconnect the flash.
+ */
+void NorFlashModel_SetPresent(BOOL present);
+
+/**
+ * Makes the flash stay busy after the next program or erase.
+ * @param stuck TRUE to never finish program and erase.
+ */
+void NorFlashModel_SetStuck(BOOL stuck);
+
+/**
+ * Checks if a program or erase is in progress.
+ * @return TRUE if busy; otherwise FALSE.
+ */
+BOOL NorFlashModel_IsBusy(void);
+
+/**
+ * Gets the memory for direct inspection.
+ * @return The memory, size bytes.
+ */
+uint8_t* NorFlashModel_GetMemory(void);
+
+/**
+ * Gets the counters.
+ * @return The statistics.
+ */
+const NorFlashModel_StatisticsType* NorFlashModel_GetStatistics(void);
+
+#endif
@@ -0,0 +1,197 @@
+/**
+ ******************************************************************************
+ * @file    Rs485_Test.c
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Host test of the Rs485 UartIf channel lookup.
+ *
+ * Checks that every configured UartIf channel is dispatched to its Rs485
+ * channel, and that unused UartIf channels and UartIf channels beyond the
+ * lookup table are ignored. The time per ISR dispatch of the first and the
+ * last channel is printed for information only, it depends on the host.
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "BSP/Rs485.h"
+#include "BSP/UartIf.h"
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+#define TEST_NUMBER_OF_UART_CHANNELS      64u
+#define TEST_NUMBER_OF_CHANNELS           33u
+#define TEST_CALLS                        1000u
+#define TEST_RUNS                         200u
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+static uint8_t Test_notified;
+static uint32_t Test_notifications;
+
+static void Test_Notify(const uint8_t channel)
+{
+  Test_notified = channel;
+  Test_notifications++;
+}
+
+/* Rs485 channel i uses UartIf channel 2 * i + 1, the others are unused.
+ *  The last one is beyond the lookup table and never dispatched */
+#define TEST_CHANNEL(i)                                                       \
+  { (uint8_t) (2u * (i) + 1u), GpioIf_ChannelD15, Test_Notify, Test_Notify, Test_Notify }
+#define TEST_CHANNELS_4(i)                                                    \
+  TEST_CHANNEL(i), TEST_CHANNEL((i) + 1u), TEST_CHANNEL((i) + 2u), TEST_CHANNEL((i) + 3u)
+
+static const Rs485_ChannelConfigType Test_channelConfigs[TEST_NUMBER_OF_CHANNELS] =
+{
+  TEST_CHANNELS_4(0u), TEST_CHANNELS_4(4u), TEST_CHANNELS_4(8u), TEST_CHANNELS_4(12u),
+  TEST_CHANNELS_4(16u), TEST_CHANNELS_4(20u), TEST_CHANNELS_4(24u), TEST_CHANNELS_4(28u),
+  TEST_CHANNEL(32u)
+};
+static uint8_t Test_lookup[TEST_NUMBER_OF_UART_CHANNELS];
+
+static const Rs485_ConfigType Test_config =
+{
+  TEST_NUMBER_OF_CHANNELS,
+  Test_channelConfigs,
+  TEST_NUMBER_OF_UART_CHANNELS,
+  Test_lookup
+};
+
+/****************************************************************
+ * Stubs of the used modules
+ ***************************************************************/
+
+void GpioIf_SetBit(GpioIf_ChannelType channel)
+{
+  (void) channel;
+}
+
+void GpioIf_ClrBit(GpioIf_ChannelType channel)
+{
+  (void) channel;
+}
+
+UartIf_LengthType UartIf_GetData(const uint8_t channel, UartIf_DataType* dst,
+                                 const UartIf_LengthType len)
+{
+  (void) channel;
+  (void) dst;
+  (void) len;
+  return 0u;
+}
+
+UartIf_LengthType UartIf_PutData(const uint8_t channel,
+                                 const UartIf_DataType* src,
+                                 const UartIf_LengthType len)
+{
+  (void) channel;
+  (void) src;
+  return len;
+}
+
+/****************************************************************
+ * Test functions
+ ***************************************************************/
+
+static uint64_t Test_GetNanoseconds(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint64_t) now.tv_sec * 1000000000u) + (uint64_t) now.tv_nsec;
+}
+
+/* Minimum over several runs, to filter out interruptions of the host */
+static uint64_t Test_MeasureRxIsr(const uint8_t uartChannel)
+{
+  uint64_t best;
+  uint64_t start;
+  uint64_t duration;
+  uint32_t run;
+  uint32_t call;
+
+  best = UINT64_MAX;
+  for (run = 0u; run < TEST_RUNS; run++)
+  {
+    start = Test_GetNanoseconds();
+    for (call = 0u; call < TEST_CALLS; call++)
+    {
+      Rs485_RxIsr(uartChannel);
+    }
+    duration = Test_GetNanoseconds() - start;
+    if (duration < best)
+    {
+      best = duration;
+    }
+  }
+
+  return best;
+}
+
+int main(void)
+{
+  uint8_t uartChannel;
+  int failures;
+  uint64_t first;
+  uint64_t last;
+
+  failures = 0;
+
+  Rs485_Init(&Test_config);
+
+  /* Mapping, up to the last configured UartIf channel and beyond */
+  for (uartChannel = 0u; uartChannel < TEST_NUMBER_OF_UART_CHANNELS + 4u; uartChannel++)
+  {
+    Test_notifications = 0u;
+    Test_notified = RS485_CHANNEL_INVALID;
+    Rs485_RxIsr(uartChannel);
+    Rs485_TxDreIsr(uartChannel);
+    Rs485_TxCompleteIsr(uartChannel);
+
+    if (((uartChannel & 1u) != 0u) && (uartChannel < TEST_NUMBER_OF_UART_CHANNELS))
+    {
+      if ((Test_notifications != 3u) || (Test_notified != (uartChannel / 2u)))
+      {
+        printf("FAIL: UartIf channel %u dispatched to %u (%u notifications)\n",
+               uartChannel, Test_notified, (unsigned) Test_notifications);
+        failures++;
+      }
+    }
+    else if (Test_notifications != 0u)
+    {
+      printf("FAIL: unused UartIf channel %u dispatched\n", uartChannel);
+      failures++;
+    }
+  }
+
+  /* The highest UartIf channel number is ignored as well */
+  Test_notifications = 0u;
+  Rs485_RxIsr(0xFFu);
+  Rs485_TxDreIsr(0xFFu);
+  Rs485_TxCompleteIsr(0xFFu);
+  if (Test_notifications != 0u)
+  {
+    printf("FAIL: UartIf channel 255 dispatched\n");
+    failures++;
+  }
+
+  /* Time of the first and the last dispatched channel, for information */
+  first = Test_MeasureRxIsr(1u);
+  last = Test_MeasureRxIsr((uint8_t) (TEST_NUMBER_OF_UART_CHANNELS - 1u));
+  printf("Rs485_RxIsr: %.1f ns (first channel), %.1f ns (last of %u)\n",
+         (double) first / TEST_CALLS, (double) last / TEST_CALLS,
+         TEST_NUMBER_OF_CHANNELS - 1u);
+
+  printf("%s\n", (failures == 0) ? "PASS" : "FAIL");
+  return (failures == 0) ? 0 : 1;
+}
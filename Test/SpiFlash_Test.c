@@ -0,0 +1,607 @@
+/**
+ ******************************************************************************
+ * @file    SpiFlash_Test.c
+ * @author  agent
+ * @version V1.0.0
+ * @date    19.10.2026
+ * @brief   Host test of SpiFlash and FlashLog against the NOR flash model.
+ *
+ * SpiIf is replaced by a job executor, which clocks the queued transactions
+ * through the model. The main functions are called many times per tick, as
+ * with an idle main loop, so the status polls per tick are visible.
+ *
+ *   SpiFlash_Test                              probing, requests, log, recovery
+ *   SpiFlash_Test remount <image> <old> <next> mounts a saved flash image
+ *
+ * Copyright (c) FH OÖ Forschungs und Entwicklungs GmbH, thermocollect
+ * You may not use or copy this file except with written permission of the owners.
+ ******************************************************************************
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "Devices/SpiFlash.h"
+#include "Services/FlashLog.h"
+#include "Services/SysTimerIf.h"
+#include "NorFlashModel.h"
+
+/****************************************************************
+ * Macros
+ ***************************************************************/
+
+#define TEST_JEDEC_ID                     0xEF4011u
+#define TEST_FLASH_SIZE                   0x10000u
+#define TEST_SECTOR_SIZE                  4096u
+#define TEST_PAGE_SIZE                    256u
+#define TEST_PROGRAM_TICKS                1u
+#define TEST_ERASE_TICKS                  40u
+
+#define TEST_BUSY_TIMEOUT                 100u
+#define TEST_POLL_INTERVAL                1u
+#define TEST_REPROBE_INTERVAL             50u
+#define TEST_REQUEST_QUEUE_SIZE           4u
+#define TEST_SPI_QUEUE_SIZE               4u
+
+#define TEST_LOG_FIRST_SECTOR             2u
+#define TEST_LOG_SECTORS                  4u
+#define TEST_LOG_PAYLOAD_SIZE             24u
+#define TEST_LOG_PENDING                  2u
+#define TEST_LOG_RECORDS_PER_SECTOR                                         \
+  ((TEST_SECTOR_SIZE - FLASHLOG_HEADER_SIZE) / FLASHLOG_SLOT_SIZE(TEST_LOG_PAYLOAD_SIZE))
+#define TEST_LOG_RECORDS                  (TEST_LOG_SECTORS * TEST_LOG_RECORDS_PER_SECTOR + 50u)
+
+/* Main function calls per tick and limit of the waits */
+#define TEST_CALLS_PER_TICK               20u
+#define TEST_MAX_TICKS                    10000u
+
+#define TEST_CHECK(condition)                                               \
+  do                                                                        \
+  {                                                                         \
+    if (!(condition))                                                       \
+    {                                                                       \
+      printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #condition);           \
+      Test_failures++;                                                      \
+    }                                                                       \
+  } while (0)
+
+/****************************************************************
+ * Global variables
+ ***************************************************************/
+
+static int Test_failures;
+static uint32_t Test_ticks;
+static uint32_t Test_notifications;
+
+/* Pool of one one-shot timer */
+static SysTimerIf_CallbackType Test_timerCallback;
+static uint32_t Test_timerExpiry;
+static uint32_t Test_crc;
+
+static const SpiIf_DeviceConfigType Test_spiDevice;
+static SpiIf_JobType* Test_spiQueue[TEST_SPI_QUEUE_SIZE];
+static uint8_t Test_spiQueued;
+
+static const NorFlashModel_ConfigType Test_norConfig =
+{
+  TEST_JEDEC_ID,
+  TEST_FLASH_SIZE,
+  TEST_SECTOR_SIZE,
+  TEST_PAGE_SIZE,
+  TEST_PROGRAM_TICKS,
+  TEST_ERASE_TICKS
+};
+
+static SpiFlash_RequestType* Test_requests[TEST_REQUEST_QUEUE_SIZE];
+static SpiFlash_QueueType Test_requestQueue =
+{
+  Test_requests,
+  0u,
+  0u,
+  TEST_REQUEST_QUEUE_SIZE,
+  TEST_REQUEST_QUEUE_SIZE
+};
+static SpiFlash_RuntimeType Test_flashRuntime;
+static SpiFlash_DeviceConfigType Test_flashDevices[1] =
+{
+  {
+    0u,
+    &Test_spiDevice,
+    0u,
+    TEST_JEDEC_ID,
+    TEST_FLASH_SIZE,
+    TEST_SECTOR_SIZE,
+    TEST_PAGE_SIZE,
+    TRUE,
+    TEST_BUSY_TIMEOUT,
+    TEST_POLL_INTERVAL,
+    TEST_REPROBE_INTERVAL,
+    &Test_requestQueue,
+    &Test_flashRuntime
+  }
+};
+
+static void Test_Notify(void);
+
+SpiFlash_ConfigType SpiFlash_config =
+{
+  1u,
+  Test_flashDevices,
+  Test_Notify
+};
+
+static SpiFlash_RequestType Test_logRequests[TEST_LOG_PENDING];
+static uint8_t Test_logBuffers[TEST_LOG_PENDING][FLASHLOG_SLOT_SIZE(TEST_LOG_PAYLOAD_SIZE)];
+static uint8_t Test_logReadBuffer[FLASHLOG_SLOT_SIZE(TEST_LOG_PAYLOAD_SIZE)];
+static FlashLog_RuntimeType Test_logRuntime;
+
+FlashLog_ConfigType FlashLog_config =
+{
+  0u,
+  TEST_LOG_FIRST_SECTOR,
+  TEST_LOG_SECTORS,
+  TEST_SECTOR_SIZE,
+  TEST_LOG_PAYLOAD_SIZE,
+  TEST_LOG_PENDING,
+  Test_logRequests,
+  &Test_logBuffers[0][0],
+  Test_logReadBuffer,
+  &Test_logRuntime
+};
+
+/****************************************************************
+ * Stand-ins of the used modules
+ ***************************************************************/
+
+uint32_t SysTimerIf_GetTicks(void)
+{
+  return Test_ticks;
+}
+
+SysTimerIf_HandleType SysTimerIf_Create(SysTimerIf_CallbackType callback,
+  const uint32_t timeout, const uint32_t period)
+{
+  SysTimerIf_HandleType handle;
+
+  handle = SYSTIMERIF_INVALID_HANDLE;
+  if ((Test_timerCallback == NULL_PTR) && (period == 0u))
+  {
+    Test_timerCallback = callback;
+    Test_timerExpiry = Test_ticks + timeout;
+    handle = 1u;
+  }
+
+  return handle;
+}
+
+BOOL SysTimerIf_IsValid(const SysTimerIf_HandleType handle)
+{
+  return (handle == 1u) && (Test_timerCallback != NULL_PTR);
+}
+
+/* CRC unit: CRC-32 (0x04C11DB7, MSB first), reset value 0xFFFFFFFF */
+void CRC_ResetDR(void)
+{
+  Test_crc = 0xFFFFFFFFu;
+}
+
+uint32_t CrcIf_CalcBlock8(const uint8_t* buffer, const uint32_t length)
+{
+  uint32_t i;
+  uint8_t bit;
+
+  for (i = 0u; i < length; i++)
+  {
+    Test_crc ^= (uint32_t) buffer[i] << 24;
+    for (bit = 0u; bit < 8u; bit++)
+      Test_crc = (Test_crc & 0x80000000u) ? ((Test_crc << 1) ^ 0x04C11DB7u) : (Test_crc << 1);
+  }
+
+  return Test_crc;
+}
+
+void SpiIf_EnqueueJob(uint8_t channel, SpiIf_JobType* job)
+{
+  SpiIf_JobType* link;
+
+  (void) channel;
+  for (link = job; link != NULL_PTR; link = link->next)
+  {
+    link->currentTxIdx = 0u;
+    link->currentRxIdx = 0u;
+    link->state = SpiIf_JobReverted;
+  }
+
+  if (Test_spiQueued < TEST_SPI_QUEUE_SIZE)
+  {
+    Test_spiQueue[Test_spiQueued++] = job;
+    for (link = job; link != NULL_PTR; link = link->next)
+      link->state = SpiIf_JobQueued;
+  }
+}
+
+BOOL SpiIf_IsJobProcessed(const SpiIf_JobType* job)
+{
+  while (job->next != NULL_PTR)
+    job = job->next;
+
+  return job->state == SpiIf_JobProcessed;
+}
+
+/****************************************************************
+ * Test functions
+ ***************************************************************/
+
+static void Test_Notify(void)
+{
+  Test_notifications++;
+}
+
+/* Clocks the oldest queued transaction through the flash model */
+static void Test_ProcessSpi(void)
+{
+  SpiIf_JobType* head;
+  SpiIf_JobType* job;
+  SpiIf_LengthType length;
+  SpiIf_LengthType i;
+  uint8_t rx;
+  uint8_t q;
+  BOOL selected;
+
+  if (Test_spiQueued > 0u)
+  {
+    head = Test_spiQueue[0];
+    for (q = 1u; q < Test_spiQueued; q++)
+      Test_spiQueue[q - 1u] = Test_spiQueue[q];
+    Test_spiQueued--;
+
+    selected = FALSE;
+    for (job = head; job != NULL_PTR; job = job->next)
+    {
+      if (!selected)
+      {
+        NorFlashModel_Select();
+        selected = TRUE;
+      }
+
+      length = (SpiIf_LengthType) (job->receiveBegin + job->receiveLength);
+      if (length < job->transmittLength)
+        length = job->transmittLength;
+
+      for (i = 0u; i < length; i++)
+      {
+        rx = NorFlashModel_Exchange((i < job->transmittLength) ? job->transmittBuffer[i] : 0xFFu);
+        if ((i >= job->receiveBegin) && (i < job->receiveBegin + job->receiveLength))
+          job->receiveBuffer[i - job->receiveBegin] = rx;
+      }
+      job->state = SpiIf_JobProcessed;
+
+      if (!job->keepCs || (job->next == NULL_PTR))
+      {
+        NorFlashModel_Deselect();
+        selected = FALSE;
+      }
+    }
+
+    for (job = head; job != NULL_PTR; job = job->next)
+    {
+      if (job->completion != NULL_PTR)
+        job->completion(job);
+    }
+  }
+}
+
+static void Test_Run(uint32_t ticks)
+{
+  SysTimerIf_CallbackType callback;
+  uint32_t tick;
+  uint32_t call;
+
+  for (tick = 0u; tick < ticks; tick++)
+  {
+    for (call = 0u; call < TEST_CALLS_PER_TICK; call++)
+    {
+      Test_ProcessSpi();
+      SpiFlash_MainFunction();
+      FlashLog_MainFunction();
+    }
+    Test_ticks++;
+    NorFlashModel_Tick();
+
+    if ((Test_timerCallback != NULL_PTR) && (Test_ticks >= Test_timerExpiry))
+    {
+      callback = Test_timerCallback;
+      Test_timerCallback = NULL_PTR;
+      callback();
+    }
+  }
+}
+
+static BOOL Test_WaitRequest(const SpiFlash_RequestType* request)
+{
+  uint32_t ticks;
+
+  for (ticks = 0u; (ticks < TEST_MAX_TICKS)
+    && ((request->state == SpiFlash_RequestQueued)
+      || (request->state == SpiFlash_RequestBusy)); ticks++)
+  {
+    Test_Run(1u);
+  }
+
+  return request->state == SpiFlash_RequestDone;
+}
+
+static BOOL Test_WaitReady(void)
+{
+  uint32_t ticks;
+
+  for (ticks = 0u; (ticks < TEST_MAX_TICKS) && !SpiFlash_IsReady(0u); ticks++)
+    Test_Run(1u);
+
+  return SpiFlash_IsReady(0u);
+}
+
+static BOOL Test_WaitMounted(void)
+{
+  uint32_t ticks;
+
+  for (ticks = 0u; (ticks < TEST_MAX_TICKS) && !FlashLog_IsMounted(); ticks++)
+    Test_Run(1u);
+
+  return FlashLog_IsMounted();
+}
+
+static void Test_MakePayload(FlashLog_SequenceType sequence, uint8_t* payload)
+{
+  uint8_t i;
+
+  for (i = 0u; i < TEST_LOG_PAYLOAD_SIZE; i++)
+    payload[i] = (uint8_t) (sequence * 7u + i);
+}
+
+static BOOL Test_ReadRecord(FlashLog_SequenceType sequence)
+{
+  uint8_t expected[TEST_LOG_PAYLOAD_SIZE];
+  uint8_t payload[TEST_LOG_PAYLOAD_SIZE];
+  FlashLog_ReadResultType result;
+  uint32_t ticks;
+
+  if (!FlashLog_Read(sequence, payload))
+    return FALSE;
+
+  result = FlashLog_GetReadResult();
+  for (ticks = 0u; (ticks < TEST_MAX_TICKS) && (result == FlashLog_ReadPending); ticks++)
+  {
+    Test_Run(1u);
+    result = FlashLog_GetReadResult();
+  }
+
+  Test_MakePayload(sequence, expected);
+  return (result == FlashLog_ReadOk) && (memcmp(payload, expected, sizeof(payload)) == 0);
+}
+
+static void Test_Probing(void)
+{
+  /* No flash connected: probing fails, requests are rejected */
+  NorFlashModel_SetPresent(FALSE);
+  Test_Run(10u);
+  TEST_CHECK(!SpiFlash_IsReady(0u));
+  TEST_CHECK(Test_flashRuntime.state == SpiFlash_StateError);
+
+  /* Flash connected later: found with the next probe */
+  NorFlashModel_SetPresent(TRUE);
+  TEST_CHECK(Test_WaitReady());
+  TEST_CHECK(SpiFlash_GetJedecId(0u) == TEST_JEDEC_ID);
+}
+
+static void Test_Requests(void)
+{
+  static uint8_t data[300];
+  static uint8_t readBack[400];
+  SpiFlash_RequestType request;
+  uint16_t i;
+  const uint8_t* memory;
+
+  memory = NorFlashModel_GetMemory();
+  for (i = 0u; i < sizeof(data); i++)
+    data[i] = (uint8_t) (i ^ 0x5Au);
+
+  /* Erase and program across a page boundary; while the flash is busy the
+   *  driver is woken by the poll timer, not on every main function call */
+  request = (SpiFlash_RequestType) { SpiFlash_RequestErase, 0x1000u, NULL_PTR, 0u, SpiFlash_RequestIdle };
+  Test_notifications = 0u;
+  TEST_CHECK(SpiFlash_Enqueue(0u, &request));
+  TEST_CHECK(Test_WaitRequest(&request));
+  printf("SpiFlash: %u notifications during a %u tick erase\n",
+    (unsigned) Test_notifications, (unsigned) TEST_ERASE_TICKS);
+  TEST_CHECK(Test_notifications <= 3u * TEST_ERASE_TICKS);
+
+  request = (SpiFlash_RequestType) { SpiFlash_RequestProgram, 0x1000u + 200u, data, sizeof(data), SpiFlash_RequestIdle };
+  TEST_CHECK(SpiFlash_Enqueue(0u, &request));
+  TEST_CHECK(Test_WaitRequest(&request));
+  TEST_CHECK(memcmp(&memory[0x1000u + 200u], data, sizeof(data)) == 0);
+
+  /* Read with the surrounding erased bytes */
+  request = (SpiFlash_RequestType) { SpiFlash_RequestRead, 0x1000u + 100u, readBack, sizeof(readBack), SpiFlash_RequestIdle };
+  TEST_CHECK(SpiFlash_Enqueue(0u, &request));
+  TEST_CHECK(Test_WaitRequest(&request));
+  TEST_CHECK((readBack[0] == 0xFFu) && (readBack[99] == 0xFFu));
+  TEST_CHECK(memcmp(&readBack[100], data, sizeof(data)) == 0);
+
+  /* Requests beyond the flash are rejected */
+  request = (SpiFlash_RequestType) { SpiFlash_RequestRead, TEST_FLASH_SIZE - 1u, readBack, 2u, SpiFlash_RequestIdle };
+  TEST_CHECK(!SpiFlash_Enqueue(0u, &request));
+
+  /* Programming without erase only clears bits */
+  request = (SpiFlash_RequestType) { SpiFlash_RequestProgram, 0x1000u + 200u, readBack, 1u, SpiFlash_RequestIdle };
+  readBack[0] = 0x0Fu;
+  TEST_CHECK(SpiFlash_Enqueue(0u, &request));
+  TEST_CHECK(Test_WaitRequest(&request));
+  TEST_CHECK(memory[0x1000u + 200u] == (uint8_t) (data[0] & 0x0Fu));
+}
+
+static void Test_Log(void)
+{
+  static uint8_t fillerData[TEST_REQUEST_QUEUE_SIZE][4];
+  SpiFlash_RequestType fillers[TEST_REQUEST_QUEUE_SIZE];
+  uint8_t payload[TEST_LOG_PAYLOAD_SIZE];
+  FlashLog_SequenceType sequence;
+  uint32_t ticks;
+  uint32_t erases;
+  uint8_t i;
+
+  FlashLog_Init(&FlashLog_config);
+  TEST_CHECK(Test_WaitMounted());
+  TEST_CHECK(FlashLog_GetNextSequence() == 0u);
+
+  /* Append beyond the log size, the oldest sector is erased */
+  for (sequence = 0u; sequence < TEST_LOG_RECORDS; sequence++)
+  {
+    Test_MakePayload(sequence, payload);
+    for (ticks = 0u; (ticks < TEST_MAX_TICKS) && !FlashLog_Append(payload); ticks++)
+      Test_Run(1u);
+  }
+  Test_Run(TEST_ERASE_TICKS);
+
+  TEST_CHECK(FlashLog_GetNextSequence() == TEST_LOG_RECORDS);
+  TEST_CHECK(FlashLog_GetOldestSequence() == TEST_LOG_RECORDS_PER_SECTOR);
+
+  /* All records in the log are intact, the erased ones are gone */
+  for (sequence = FlashLog_GetOldestSequence(); sequence < FlashLog_GetNextSequence(); sequence++)
+  {
+    if (!Test_ReadRecord(sequence))
+    {
+      printf("FAIL: record %u\n", (unsigned) sequence);
+      Test_failures++;
+      break;
+    }
+  }
+  TEST_CHECK(!FlashLog_Read(FlashLog_GetOldestSequence() - 1u, payload));
+
+  /* A new sector needs room for erase, header and record, otherwise nothing
+   *  is queued (a lone erase would be repeated by the next append) */
+  for (ticks = 0u; (ticks < TEST_MAX_TICKS)
+    && ((FlashLog_GetNextSequence() % TEST_LOG_RECORDS_PER_SECTOR) != 0u); ticks++)
+  {
+    Test_MakePayload(FlashLog_GetNextSequence(), payload);
+    if (!FlashLog_Append(payload))
+      Test_Run(1u);
+  }
+  Test_Run(TEST_ERASE_TICKS);
+  erases = NorFlashModel_GetStatistics()->erases;
+
+  for (i = 0u; i < TEST_REQUEST_QUEUE_SIZE - 1u; i++)
+  {
+    fillers[i] = (SpiFlash_RequestType) { SpiFlash_RequestRead, 0u, fillerData[i], 4u, SpiFlash_RequestIdle };
+    TEST_CHECK(SpiFlash_Enqueue(0u, &fillers[i]));
+  }
+  Test_MakePayload(FlashLog_GetNextSequence(), payload);
+  TEST_CHECK(!FlashLog_Append(payload));
+  TEST_CHECK(SpiFlash_GetQueueSpace(0u) == 1u);
+
+  for (ticks = 0u; (ticks < TEST_MAX_TICKS) && !FlashLog_Append(payload); ticks++)
+    Test_Run(1u);
+  Test_Run(TEST_ERASE_TICKS);
+  TEST_CHECK(NorFlashModel_GetStatistics()->erases == erases + 1u);
+  TEST_CHECK(Test_ReadRecord(FlashLog_GetNextSequence() - 1u));
+}
+
+static void Test_Recovery(void)
+{
+  SpiFlash_RequestType first;
+  SpiFlash_RequestType second;
+  uint32_t ticks;
+
+  /* The flash hangs in an erase: the request fails after the busy timeout
+   *  and the device is probed again, once the flash is back */
+  NorFlashModel_SetStuck(TRUE);
+  first = (SpiFlash_RequestType) { SpiFlash_RequestErase, 0u, NULL_PTR, 0u, SpiFlash_RequestIdle };
+  second = (SpiFlash_RequestType) { SpiFlash_RequestErase, TEST_SECTOR_SIZE, NULL_PTR, 0u, SpiFlash_RequestIdle };
+  TEST_CHECK(SpiFlash_Enqueue(0u, &first));
+  TEST_CHECK(SpiFlash_Enqueue(0u, &second));
+  TEST_CHECK(!Test_WaitRequest(&first));
+  TEST_CHECK(Test_ticks >= TEST_BUSY_TIMEOUT);
+  Test_Run(1u);
+  TEST_CHECK(second.state == SpiFlash_RequestFailed);
+  TEST_CHECK(!SpiFlash_IsReady(0u));
+  TEST_CHECK(!SpiFlash_Enqueue(0u, &first));
+
+  NorFlashModel_SetStuck(FALSE);
+  for (ticks = 0u; (ticks < TEST_MAX_TICKS) && NorFlashModel_IsBusy(); ticks++)
+    Test_Run(1u);
+  TEST_CHECK(Test_WaitReady());
+  TEST_CHECK(SpiFlash_Enqueue(0u, &first));
+  TEST_CHECK(Test_WaitRequest(&first));
+}
+
+static int Test_Remount(const char* image, FlashLog_SequenceType oldest,
+  FlashLog_SequenceType next)
+{
+  FILE* file;
+
+  file = fopen(image, "rb");
+  TEST_CHECK((file != NULL) && (fread(NorFlashModel_GetMemory(), 1u, TEST_FLASH_SIZE, file)
+    == TEST_FLASH_SIZE));
+  if (file != NULL)
+    fclose(file);
+
+  SpiFlash_Init(&SpiFlash_config);
+  FlashLog_Init(&FlashLog_config);
+  TEST_CHECK(Test_WaitMounted());
+  TEST_CHECK(FlashLog_GetOldestSequence() == oldest);
+  TEST_CHECK(FlashLog_GetNextSequence() == next);
+  TEST_CHECK(Test_ReadRecord(oldest));
+  TEST_CHECK(Test_ReadRecord(next - 1u));
+
+  return Test_failures;
+}
+
+int main(int argc, char* argv[])
+{
+  const NorFlashModel_StatisticsType* statistics;
+  char image[] = "/tmp/SpiFlash_TestXXXXXX";
+  char oldest[16];
+  char next[16];
+  char command[256];
+  FILE* file;
+  int fd;
+
+  NorFlashModel_Init(&Test_norConfig);
+  statistics = NorFlashModel_GetStatistics();
+
+  if ((argc == 5) && (strcmp(argv[1], "remount") == 0))
+    return Test_Remount(argv[2], (FlashLog_SequenceType) atol(argv[3]),
+      (FlashLog_SequenceType) atol(argv[4]));
+
+  SpiFlash_Init(&SpiFlash_config);
+  Test_Probing();
+  Test_Requests();
+  Test_Log();
+
+  /* Busy flash is polled at most once per tick, and never commanded */
+  printf("SpiFlash: %u programs, %u erases, %u busy polls (max %u per tick)\n",
+    (unsigned) statistics->programs, (unsigned) statistics->erases,
+    (unsigned) statistics->busyPolls, (unsigned) statistics->maxPollsPerTick);
+  TEST_CHECK(statistics->maxPollsPerTick <= 1u);
+  TEST_CHECK(statistics->violations == 0u);
+
+  /* Mount the written log from scratch (new process, like a reset) */
+  fd = mkstemp(image);
+  file = (fd >= 0) ? fdopen(fd, "wb") : NULL;
+  TEST_CHECK((file != NULL)
+    && (fwrite(NorFlashModel_GetMemory(), 1u, TEST_FLASH_SIZE, file) == TEST_FLASH_SIZE));
+  if (file != NULL)
+    fclose(file);
+  snprintf(oldest, sizeof(oldest), "%u", (unsigned) FlashLog_GetOldestSequence());
+  snprintf(next, sizeof(next), "%u", (unsigned) FlashLog_GetNextSequence());
+  snprintf(command, sizeof(command), "%s remount %s %s %s", argv[0], image, oldest, next);
+  TEST_CHECK(system(command) == 0);
+  unlink(image);
+
+  Test_Recovery();
+
+  printf("%s\n", (Test_failures == 0) ? "PASS" : "FAIL");
+  return (Test_failures == 0) ? 0 : 1;
+}
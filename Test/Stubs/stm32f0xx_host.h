@@ -0,0 +1,299 @@
+/**
+ * Host build stand-in for the STM32F0 CMSIS and standard peripheral
+ * library headers: types, register layouts and function prototypes only.
+ * Peripheral addresses must not be dereferenced by host tests.
+ */
+#ifndef STM32F0XX_HOST_H
+#define STM32F0XX_HOST_H
+#include <stdint.h>
+#define __IO volatile
+#define __INLINE inline
+#define __STATIC_INLINE static inline
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+typedef enum {ERROR = 0, SUCCESS = !ERROR} ErrorStatus;
+typedef enum { SysTick_IRQn=-1, WWDG_IRQn=0, EXTI0_1_IRQn=5, EXTI2_3_IRQn=6, EXTI4_15_IRQn=7,
+ DMA1_Channel1_IRQn=9, DMA1_Channel2_3_IRQn=10, DMA1_Channel4_5_IRQn=11, TIM1_CC_IRQn=14, TIM2_IRQn=15, TIM3_IRQn=16, TIM14_IRQn=19, TIM15_IRQn=20,
+ SPI1_IRQn=25, SPI2_IRQn=26, USART1_IRQn=27, USART2_IRQn=28 } IRQn_Type;
+void NVIC_EnableIRQ(IRQn_Type); void NVIC_DisableIRQ(IRQn_Type); void NVIC_SetPriority(IRQn_Type, uint32_t);
+void NVIC_SetPendingIRQ(IRQn_Type);
+void __disable_irq(void); void __enable_irq(void); uint32_t __get_PRIMASK(void); void __set_PRIMASK(uint32_t); void __WFI(void); void __DSB(void); void __DMB(void); void __ISB(void); void __NOP(void);
+#define assert_param(x) ((void)0)
+typedef struct { __IO uint32_t CTRL, LOAD, VAL, CALIB; } SysTick_Type;
+#define SysTick ((SysTick_Type*)0xE000E010u)
+#define SysTick_CTRL_ENABLE_Msk 1u
+#define SysTick_CTRL_TICKINT_Msk 2u
+#define SysTick_CTRL_CLKSOURCE_Msk 4u
+#define SysTick_CTRL_COUNTFLAG_Msk (1u<<16)
+#define SysTick_LOAD_RELOAD_Msk 0xFFFFFFu
+uint32_t SysTick_Config(uint32_t);
+void SysTick_CLKSourceConfig(uint32_t);
+#define SysTick_CLKSource_HCLK 4u
+typedef struct { volatile uint32_t ISR, IFCR; } DMA_TypeDef;
+typedef struct { volatile uint32_t CCR, CNDTR, CPAR, CMAR; } DMA_Channel_TypeDef;
+#define DMA1 ((DMA_TypeDef*)0x40020000u)
+#define DMA1_Channel1 ((DMA_Channel_TypeDef*)0x40020008u)
+#define DMA1_Channel2 ((DMA_Channel_TypeDef*)0x4002001Cu)
+#define DMA1_Channel3 ((DMA_Channel_TypeDef*)0x40020030u)
+#define DMA1_Channel4 ((DMA_Channel_TypeDef*)0x40020044u)
+#define DMA1_Channel5 ((DMA_Channel_TypeDef*)0x40020058u)
+#define DMA_CCR_EN 1u
+#define DMA_CCR_TCIE 2u
+#define DMA_CCR_MINC 0x80u
+#define DMA_CCR_PSIZE 0x300u
+#define DMA_CCR_PSIZE_0 0x100u
+#define DMA_CCR_MSIZE 0xC00u
+#define DMA_CCR_MSIZE_0 0x400u
+#define DMA_CCR_CIRC 0x20u
+typedef struct { uint32_t DMA_PeripheralBaseAddr, DMA_MemoryBaseAddr, DMA_DIR, DMA_BufferSize, DMA_PeripheralInc, DMA_MemoryInc, DMA_PeripheralDataSize, DMA_MemoryDataSize, DMA_Mode, DMA_Priority, DMA_M2M; } DMA_InitTypeDef;
+void DMA_Init(DMA_Channel_TypeDef*, DMA_InitTypeDef*); void DMA_DeInit(DMA_Channel_TypeDef*); void DMA_Cmd(DMA_Channel_TypeDef*, FunctionalState); void DMA_ITConfig(DMA_Channel_TypeDef*, uint32_t, FunctionalState);
+void DMA_SetCurrDataCounter(DMA_Channel_TypeDef*, uint16_t); uint16_t DMA_GetCurrDataCounter(DMA_Channel_TypeDef*);
+ITStatus DMA_GetITStatus(uint32_t); void DMA_ClearITPendingBit(uint32_t);
+#define DMA_DIR_PeripheralDST 0x10u
+#define DMA_DIR_PeripheralSRC 0u
+#define DMA_PeripheralInc_Disable 0u
+#define DMA_MemoryInc_Enable 0x80u
+#define DMA_MemoryInc_Disable 0u
+#define DMA_PeripheralDataSize_Byte 0u
+#define DMA_PeripheralDataSize_HalfWord 0x100u
+#define DMA_PeripheralDataSize_Word 0x200u
+#define DMA_MemoryDataSize_Byte 0u
+#define DMA_MemoryDataSize_HalfWord 0x400u
+#define DMA_MemoryDataSize_Word 0x800u
+#define DMA_Mode_Normal 0u
+#define DMA_Mode_Circular 0x20u
+#define DMA_Priority_High 0x2000u
+#define DMA_Priority_Medium 0x1000u
+#define DMA_Priority_Low 0u
+#define DMA_Priority_VeryHigh 0x3000u
+#define DMA_M2M_Disable 0u
+#define DMA_IT_TC 2u
+#define DMA1_IT_GL2 0x10u
+#define DMA1_IT_TC2 0x20u
+#define DMA1_IT_GL3 0x100u
+#define DMA1_IT_GL4 0x1000u
+#define DMA1_IT_TC4 0x2000u
+#define DMA1_IT_GL5 0x10000u
+void RCC_AHBPeriphClockCmd(uint32_t, FunctionalState);
+void RCC_APB1PeriphClockCmd(uint32_t, FunctionalState);
+void RCC_APB2PeriphClockCmd(uint32_t, FunctionalState);
+#define RCC_AHBPeriph_DMA1 1u
+#define RCC_AHBPeriph_GPIOA 0x20000u
+#define RCC_AHBPeriph_GPIOB 0x40000u
+#define RCC_AHBPeriph_GPIOC 0x80000u
+#define RCC_AHBPeriph_GPIOD 0x100000u
+#define RCC_AHBPeriph_CRC 0x40u
+#define RCC_APB2Periph_SYSCFG 1u
+#define RCC_APB2Periph_USART1 0x4000u
+#define RCC_APB2Periph_SPI1 0x1000u
+#define RCC_APB1Periph_SPI2 0x4000u
+#define RCC_APB1Periph_USART2 0x20000u
+#define RCC_APB1Periph_TIM2 1u
+#define RCC_APB1Periph_TIM3 2u
+#define RCC_APB1Periph_PWR 0x10000000u
+typedef struct { uint32_t SYSCLK_Frequency, HCLK_Frequency, PCLK_Frequency, ADCCLK_Frequency, CECCLK_Frequency, I2C1CLK_Frequency, USART1CLK_Frequency; } RCC_ClocksTypeDef;
+void RCC_GetClocksFreq(RCC_ClocksTypeDef*);
+/* GPIO */
+typedef struct { __IO uint32_t MODER; __IO uint16_t OTYPER; uint16_t R0; __IO uint32_t OSPEEDR, PUPDR; __IO uint16_t IDR; uint16_t R1; __IO uint16_t ODR; uint16_t R2; __IO uint32_t BSRR, LCKR, AFR[2]; __IO uint16_t BRR; uint16_t R3; } GPIO_TypeDef;
+#define GPIOA_BASE 0x48000000u
+#define GPIOB_BASE 0x48000400u
+#define GPIOA ((GPIO_TypeDef*)GPIOA_BASE)
+#define GPIOB ((GPIO_TypeDef*)GPIOB_BASE)
+#define GPIOC ((GPIO_TypeDef*)0x48000800u)
+#define GPIOD ((GPIO_TypeDef*)0x48000C00u)
+typedef enum { GPIO_Mode_IN=0, GPIO_Mode_OUT=1, GPIO_Mode_AF=2, GPIO_Mode_AN=3 } GPIOMode_TypeDef;
+typedef enum { GPIO_OType_PP=0, GPIO_OType_OD=1 } GPIOOType_TypeDef;
+typedef enum { GPIO_Speed_Level_1=0, GPIO_Speed_2MHz=0, GPIO_Speed_10MHz=1, GPIO_Speed_50MHz=3 } GPIOSpeed_TypeDef;
+typedef enum { GPIO_PuPd_NOPULL=0, GPIO_PuPd_UP=1, GPIO_PuPd_DOWN=2 } GPIOPuPd_TypeDef;
+typedef struct { uint32_t GPIO_Pin; GPIOMode_TypeDef GPIO_Mode; GPIOSpeed_TypeDef GPIO_Speed; GPIOOType_TypeDef GPIO_OType; GPIOPuPd_TypeDef GPIO_PuPd; } GPIO_InitTypeDef;
+void GPIO_Init(GPIO_TypeDef*, GPIO_InitTypeDef*); void GPIO_PinAFConfig(GPIO_TypeDef*, uint16_t, uint8_t);
+uint8_t GPIO_ReadInputDataBit(GPIO_TypeDef*, uint16_t); uint8_t GPIO_ReadOutputDataBit(GPIO_TypeDef*, uint16_t);
+void GPIO_SetBits(GPIO_TypeDef*, uint16_t); void GPIO_ResetBits(GPIO_TypeDef*, uint16_t);
+#define GPIO_AF_0 0
+#define GPIO_AF_1 1
+#define GPIO_AF_2 2
+void SYSCFG_EXTILineConfig(uint8_t, uint8_t);
+/* EXTI */
+typedef struct { __IO uint32_t IMR, EMR, RTSR, FTSR, SWIER, PR; } EXTI_TypeDef;
+#define EXTI ((EXTI_TypeDef*)0x40010400u)
+typedef enum { EXTI_Mode_Interrupt = 0, EXTI_Mode_Event = 4 } EXTIMode_TypeDef;
+typedef enum { EXTI_Trigger_Rising = 8, EXTI_Trigger_Falling = 0xC, EXTI_Trigger_Rising_Falling = 0x10 } EXTITrigger_TypeDef;
+typedef struct { uint32_t EXTI_Line; EXTIMode_TypeDef EXTI_Mode; EXTITrigger_TypeDef EXTI_Trigger; FunctionalState EXTI_LineCmd; } EXTI_InitTypeDef;
+void EXTI_Init(EXTI_InitTypeDef*); ITStatus EXTI_GetITStatus(uint32_t); void EXTI_ClearITPendingBit(uint32_t);
+/* USART */
+typedef struct { __IO uint32_t CR1, CR2, CR3, BRR, GTPR, RTOR, RQR, ISR, ICR; __IO uint16_t RDR; uint16_t r1; __IO uint16_t TDR; uint16_t r2; } USART_TypeDef;
+#define USART1 ((USART_TypeDef*)0x40013800u)
+#define USART2 ((USART_TypeDef*)0x40004400u)
+typedef struct { uint32_t USART_BaudRate, USART_WordLength, USART_StopBits, USART_Parity, USART_Mode, USART_HardwareFlowControl; } USART_InitTypeDef;
+typedef struct { uint32_t USART_Clock, USART_CPOL, USART_CPHA, USART_LastBit; } USART_ClockInitTypeDef;
+#define USART_WordLength_8b 0u
+#define USART_StopBits_1 0u
+#define USART_Parity_No 0u
+#define USART_Mode_Rx 4u
+#define USART_Mode_Tx 8u
+#define USART_HardwareFlowControl_None 0u
+#define USART_HardwareFlowControl_RTS_CTS 0x300u
+#define USART_Clock_Disable 0u
+#define USART_CPOL_Low 0u
+#define USART_CPHA_1Edge 0u
+#define USART_LastBit_Disable 0u
+#define USART_OVRDetection_Disable 0x1000u
+#define USART_IT_RXNE 1u
+#define USART_IT_TXE 2u
+#define USART_IT_TC 3u
+#define USART_IT_CTS 4u
+#define USART_IT_IDLE 5u
+#define USART_IT_ORE 6u
+#define USART_IT_NE 7u
+#define USART_IT_FE 8u
+#define USART_IT_WU 9u
+#define USART_IT_CM 10u
+#define USART_IT_EOB 11u
+#define USART_IT_RTO 12u
+void USART_Init(USART_TypeDef*, const USART_InitTypeDef*); void USART_ClockInit(USART_TypeDef*, const USART_ClockInitTypeDef*);
+void USART_ITConfig(USART_TypeDef*, uint32_t, FunctionalState); void USART_OverrunDetectionConfig(USART_TypeDef*, uint32_t);
+void USART_Cmd(USART_TypeDef*, FunctionalState); ITStatus USART_GetITStatus(USART_TypeDef*, uint32_t); void USART_ClearITPendingBit(USART_TypeDef*, uint32_t);
+uint16_t USART_ReceiveData(USART_TypeDef*); void USART_SendData(USART_TypeDef*, uint16_t);
+/* SPI */
+typedef struct { __IO uint16_t CR1; uint16_t r0; __IO uint16_t CR2; uint16_t r1; __IO uint16_t SR; uint16_t r2; __IO uint16_t DR; uint16_t r3; } SPI_TypeDef;
+#define SPI1 ((SPI_TypeDef*)0x40013000u)
+#define SPI2 ((SPI_TypeDef*)0x40003800u)
+typedef struct { uint16_t SPI_Direction, SPI_Mode, SPI_DataSize, SPI_CPOL, SPI_CPHA, SPI_NSS, SPI_BaudRatePrescaler, SPI_FirstBit, SPI_CRCPolynomial; } SPI_InitTypeDef;
+#define SPI_Direction_2Lines_FullDuplex 0u
+#define SPI_Mode_Master 0x104u
+#define SPI_DataSize_4b 0x300u
+#define SPI_DataSize_8b 0x700u
+#define SPI_DataSize_16b 0xF00u
+#define SPI_CPOL_Low 0u
+#define SPI_CPOL_High 2u
+#define SPI_CPHA_1Edge 0u
+#define SPI_CPHA_2Edge 1u
+#define SPI_NSS_Soft 0x200u
+#define SPI_BaudRatePrescaler_2 0u
+#define SPI_BaudRatePrescaler_4 8u
+#define SPI_BaudRatePrescaler_8 0x10u
+#define SPI_BaudRatePrescaler_16 0x18u
+#define SPI_FirstBit_MSB 0u
+#define SPI_FirstBit_LSB 0x80u
+#define SPI_I2S_IT_TXE 0x71u
+#define SPI_I2S_IT_RXNE 0x60u
+#define SPI_I2S_FLAG_TXE 2u
+#define SPI_I2S_FLAG_RXNE 1u
+#define SPI_I2S_FLAG_BSY 0x80u
+#define SPI_I2S_DMAReq_Tx 2u
+#define SPI_I2S_DMAReq_Rx 1u
+#define SPI_RxFIFOThreshold_HF 0u
+#define SPI_RxFIFOThreshold_QF 0x1000u
+#define SPI_CR1_SPE 0x40u
+#define SPI_CR1_CPHA 1u
+#define SPI_CR1_CPOL 2u
+#define SPI_CR1_BR 0x38u
+#define SPI_CR1_LSBFIRST 0x80u
+#define SPI_CR2_DS 0xF00u
+#define SPI_CR2_FRXTH 0x1000u
+#define SPI_CR2_LDMARX 0x2000u
+#define SPI_CR2_LDMATX 0x4000u
+#define SPI_SR_FTLVL 0x1800u
+#define SPI_SR_FRLVL 0x600u
+#define SPI_SR_BSY 0x80u
+void SPI_Init(SPI_TypeDef*, const SPI_InitTypeDef*); void SPI_Cmd(SPI_TypeDef*, FunctionalState);
+void SPI_I2S_ITConfig(SPI_TypeDef*, uint8_t, FunctionalState); ITStatus SPI_I2S_GetITStatus(SPI_TypeDef*, uint8_t);
+FlagStatus SPI_I2S_GetFlagStatus(SPI_TypeDef*, uint16_t);
+void SPI_SendData8(SPI_TypeDef*, uint8_t); uint8_t SPI_ReceiveData8(SPI_TypeDef*);
+void SPI_I2S_SendData16(SPI_TypeDef*, uint16_t); uint16_t SPI_I2S_ReceiveData16(SPI_TypeDef*);
+void SPI_RxFIFOThresholdConfig(SPI_TypeDef*, uint16_t); void SPI_I2S_DMACmd(SPI_TypeDef*, uint16_t, FunctionalState);
+void SPI_DataSizeConfig(SPI_TypeDef*, uint16_t);
+uint16_t SPI_GetReceptionFIFOStatus(SPI_TypeDef*);
+#define SPI_ReceptionFIFOStatus_Empty 0u
+#define SPI_ReceptionFIFOStatus_1QuarterFull 0x200u
+#define SPI_ReceptionFIFOStatus_HalfFull 0x400u
+#define SPI_ReceptionFIFOStatus_Full 0x600u
+/* TIM */
+typedef struct { __IO uint16_t CR1; uint16_t r0; __IO uint16_t CR2; uint16_t r1; __IO uint16_t SMCR; uint16_t r2; __IO uint16_t DIER; uint16_t r3; __IO uint16_t SR; uint16_t r4; __IO uint16_t EGR; uint16_t r5; __IO uint16_t CCMR1; uint16_t r6; __IO uint16_t CCMR2; uint16_t r7; __IO uint16_t CCER; uint16_t r8; __IO uint32_t CNT; __IO uint16_t PSC; uint16_t r9; __IO uint32_t ARR; __IO uint16_t RCR; uint16_t r10; __IO uint32_t CCR1, CCR2, CCR3, CCR4; __IO uint16_t BDTR; uint16_t r11; __IO uint16_t DCR; uint16_t r12; __IO uint16_t DMAR; uint16_t r13; } TIM_TypeDef;
+#define TIM1 ((TIM_TypeDef*)0x40012C00u)
+#define TIM2 ((TIM_TypeDef*)0x40000000u)
+#define TIM3 ((TIM_TypeDef*)0x40000400u)
+#define TIM14 ((TIM_TypeDef*)0x40002000u)
+#define TIM15 ((TIM_TypeDef*)0x40014000u)
+#define TIM16 ((TIM_TypeDef*)0x40014400u)
+#define TIM17 ((TIM_TypeDef*)0x40014800u)
+typedef struct { uint16_t TIM_Prescaler; uint16_t TIM_CounterMode; uint32_t TIM_Period; uint16_t TIM_ClockDivision; uint8_t TIM_RepetitionCounter; } TIM_TimeBaseInitTypeDef;
+typedef struct { uint16_t TIM_OCMode, TIM_OutputState, TIM_OutputNState; uint32_t TIM_Pulse; uint16_t TIM_OCPolarity, TIM_OCNPolarity, TIM_OCIdleState, TIM_OCNIdleState; } TIM_OCInitTypeDef;
+typedef struct { uint16_t TIM_Channel, TIM_ICPolarity, TIM_ICSelection, TIM_ICPrescaler, TIM_ICFilter; } TIM_ICInitTypeDef;
+#define TIM_IT_Update 1u
+#define TIM_IT_CC1 2u
+#define TIM_IT_CC2 4u
+#define TIM_FLAG_Update 1u
+#define TIM_CKD_DIV1 0u
+#define TIM_CounterMode_Up 0u
+#define TIM_OCMode_Timing 0u
+#define TIM_OCMode_PWM1 0x60u
+#define TIM_OCMode_PWM2 0x70u
+#define TIM_OutputState_Enable 1u
+#define TIM_OutputNState_Disable 0u
+#define TIM_OCPolarity_High 0u
+#define TIM_OCPolarity_Low 2u
+#define TIM_OCNPolarity_High 0u
+#define TIM_OCIdleState_Reset 0u
+#define TIM_OCNIdleState_Reset 0u
+#define TIM_OCPreload_Enable 8u
+#define TIM_OCPreload_Disable 0u
+#define TIM_Channel_1 0u
+#define TIM_Channel_2 4u
+#define TIM_ICPolarity_Rising 0u
+#define TIM_ICPolarity_Falling 2u
+#define TIM_ICSelection_DirectTI 1u
+#define TIM_ICPSC_DIV1 0u
+#define TIM_TS_TI1FP1 0x50u
+#define TIM_SlaveMode_Reset 4u
+#define TIM_MasterSlaveMode_Enable 0x80u
+#define TIM_DMA_CC1 0x200u
+#define TIM_DMABase_CCR1 0xDu
+#define TIM_DMABurstLength_2Transfers 0x100u
+#define TIM_SR_UIF 1u
+#define TIM_SR_CC1IF 2u
+#define TIM_DIER_CC1IE 2u
+#define TIM_EGR_CC1G 2u
+void TIM_DeInit(TIM_TypeDef*); void TIM_TimeBaseInit(TIM_TypeDef*, TIM_TimeBaseInitTypeDef*); void TIM_Cmd(TIM_TypeDef*, FunctionalState);
+void TIM_ITConfig(TIM_TypeDef*, uint16_t, FunctionalState); ITStatus TIM_GetITStatus(TIM_TypeDef*, uint16_t); void TIM_ClearITPendingBit(TIM_TypeDef*, uint16_t);
+FlagStatus TIM_GetFlagStatus(TIM_TypeDef*, uint16_t); void TIM_ClearFlag(TIM_TypeDef*, uint16_t);
+void TIM_SetCounter(TIM_TypeDef*, uint32_t); uint32_t TIM_GetCounter(TIM_TypeDef*);
+void TIM_OC1Init(TIM_TypeDef*, TIM_OCInitTypeDef*); void TIM_OC2Init(TIM_TypeDef*, TIM_OCInitTypeDef*); void TIM_OC3Init(TIM_TypeDef*, TIM_OCInitTypeDef*); void TIM_OC4Init(TIM_TypeDef*, TIM_OCInitTypeDef*);
+void TIM_OC1PreloadConfig(TIM_TypeDef*, uint16_t); void TIM_OC2PreloadConfig(TIM_TypeDef*, uint16_t); void TIM_OC3PreloadConfig(TIM_TypeDef*, uint16_t); void TIM_OC4PreloadConfig(TIM_TypeDef*, uint16_t);
+void TIM_SetCompare1(TIM_TypeDef*, uint32_t); void TIM_SetCompare2(TIM_TypeDef*, uint32_t); void TIM_SetCompare3(TIM_TypeDef*, uint32_t); void TIM_SetCompare4(TIM_TypeDef*, uint32_t);
+void TIM_ARRPreloadConfig(TIM_TypeDef*, FunctionalState); void TIM_CtrlPWMOutputs(TIM_TypeDef*, FunctionalState);
+void TIM_PWMIConfig(TIM_TypeDef*, TIM_ICInitTypeDef*); void TIM_SelectInputTrigger(TIM_TypeDef*, uint16_t); void TIM_SelectSlaveMode(TIM_TypeDef*, uint16_t); void TIM_SelectMasterSlaveMode(TIM_TypeDef*, uint16_t);
+void TIM_DMAConfig(TIM_TypeDef*, uint16_t, uint16_t); void TIM_DMACmd(TIM_TypeDef*, uint16_t, FunctionalState);
+uint32_t TIM_GetCapture1(TIM_TypeDef*); uint32_t TIM_GetCapture2(TIM_TypeDef*);
+/* CRC */
+typedef struct { __IO uint32_t DR; } CRC_TypeDef;
+#define CRC ((CRC_TypeDef*)0x40023000u)
+void CRC_DeInit(void); void CRC_SetInitRegister(uint32_t); void CRC_PolynomialSizeSelect(uint32_t); void CRC_ReverseInputDataSelect(uint32_t); void CRC_ReverseOutputDataCmd(FunctionalState);
+uint32_t CRC_CalcCRC(uint32_t); uint32_t CRC_CalcBlockCRC(uint32_t*, uint32_t); void CRC_ResetDR(void); uint32_t CRC_GetCRC(void);
+#define CRC_PolSize_32 0u
+#define CRC_ReverseInputData_32bits 0x60u
+/* IWDG / RTC / PWR */
+void IWDG_WriteAccessCmd(uint16_t); void IWDG_SetPrescaler(uint8_t); void IWDG_SetReload(uint16_t); void IWDG_ReloadCounter(void); void IWDG_Enable(void);
+#define IWDG_WriteAccess_Enable 0x5555u
+#define IWDG_Prescaler_256 6u
+#define IWDG_Prescaler_32 3u
+#define IWDG_Prescaler_4 0u
+typedef struct { uint32_t RTC_HourFormat, RTC_AsynchPrediv, RTC_SynchPrediv; } RTC_InitTypeDef;
+uint32_t RTC_ReadBackupRegister(uint32_t); ErrorStatus RTC_Init(RTC_InitTypeDef*); ErrorStatus RTC_WaitForSynchro(void); void RTC_TimeStampCmd(uint32_t, FunctionalState);
+#define RTC_BKP_DR0 0u
+#define RTC_HourFormat_24 0u
+#define RTC_TimeStampEdge_Falling 8u
+void PWR_BackupAccessCmd(FunctionalState); void RCC_LSEConfig(uint32_t); FlagStatus RCC_GetFlagStatus(uint8_t); void RCC_RTCCLKConfig(uint32_t); void RCC_RTCCLKCmd(FunctionalState);
+#define RCC_LSE_ON 1u
+#define RCC_FLAG_LSERDY 0x41u
+#define RCC_RTCCLKSource_LSE 0x100u
+void RCC_LSICmd(FunctionalState);
+#define RCC_FLAG_LSIRDY 0x61u
+#define LSI_VALUE 40000u
+/* SCB */
+typedef struct { __IO uint32_t CPUID, ICSR, VTOR, AIRCR, SCR, CCR; } SCB_Type;
+#define SCB ((SCB_Type*)0xE000ED00u)
+#define SCB_ICSR_PENDSTSET_Msk (1u<<26)
+#define SCB_ICSR_PENDSTCLR_Msk (1u<<25)
+#define SCB_SCR_SLEEPDEEP_Msk (1u<<2)
+#endif
@@ -0,0 +1,2 @@
+/* Host build stand-in for the STM32 standard peripheral library header */
+#include "stm32f0xx_host.h"